@@ -156,7 +156,7 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 	_screenFormat(Graphics::PixelFormat::createFormatCLUT8()),
 	_cursorFormat(Graphics::PixelFormat::createFormatCLUT8()),
 	_overlayscreen(0), _tmpscreen2(0),
-	_scalerProc(0), _screenChangeCount(0),
+	_scalerProc(0), _scalerThreadSafe(false), _screenChangeCount(0),
 	_mouseData(nullptr), _mouseSurface(nullptr),
 	_mouseOrigSurface(nullptr), _cursorDontScale(false), _cursorPaletteDisabled(true),
 	_currentShakeXOffset(0), _currentShakeYOffset(0),
@@ -580,38 +580,18 @@ void SurfaceSdlGraphicsManager::detectSupportedFormats() {
 }
 #endif
 
-int SurfaceSdlGraphicsManager::getGraphicsModeScale(int mode) const {
-	int scale;
-	switch (mode) {
-	case GFX_NORMAL:
-		scale = 1;
-		break;
-#ifdef USE_SCALERS
-	case GFX_DOUBLESIZE:
-	case GFX_2XSAI:
-	case GFX_SUPER2XSAI:
-	case GFX_SUPEREAGLE:
-	case GFX_ADVMAME2X:
-	case GFX_TV2X:
-	case GFX_DOTMATRIX:
-#ifdef USE_HQ_SCALERS
-	case GFX_HQ2X:
-#endif
-		scale = 2;
-		break;
-	case GFX_TRIPLESIZE:
-	case GFX_ADVMAME3X:
-#ifdef USE_HQ_SCALERS
-	case GFX_HQ3X:
-#endif
-		scale = 3;
-		break;
-#endif
-	default:
-		scale = -1;
+const ScalerDescriptor *SurfaceSdlGraphicsManager::getGraphicsScalerDescriptor(int mode) const {
+	for (const OSystem::GraphicsMode *gm = s_supportedGraphicsModes; gm->name; ++gm) {
+		if (gm->id == mode)
+			return findScalerDescriptor(gm->name);
 	}
 
-	return scale;
+	return nullptr;
+}
+
+int SurfaceSdlGraphicsManager::getGraphicsModeScale(int mode) const {
+	const ScalerDescriptor *desc = getGraphicsScalerDescriptor(mode);
+	return desc ? desc->factor : -1;
 }
 
 bool SurfaceSdlGraphicsManager::setGraphicsMode(int mode, uint flags) {
@@ -641,54 +621,8 @@ bool SurfaceSdlGraphicsManager::setGraphicsMode(int mode, uint flags) {
 }
 
 ScalerProc *SurfaceSdlGraphicsManager::getGraphicsScalerProc(int mode) const {
-	ScalerProc *newScalerProc = 0;
-	switch (_videoMode.mode) {
-	case GFX_NORMAL:
-		newScalerProc = Normal1x;
-		break;
-#ifdef USE_SCALERS
-	case GFX_DOUBLESIZE:
-		newScalerProc = Normal2x;
-		break;
-	case GFX_TRIPLESIZE:
-		newScalerProc = Normal3x;
-		break;
-
-	case GFX_2XSAI:
-		newScalerProc = _2xSaI;
-		break;
-	case GFX_SUPER2XSAI:
-		newScalerProc = Super2xSaI;
-		break;
-	case GFX_SUPEREAGLE:
-		newScalerProc = SuperEagle;
-		break;
-	case GFX_ADVMAME2X:
-		newScalerProc = AdvMame2x;
-		break;
-	case GFX_ADVMAME3X:
-		newScalerProc = AdvMame3x;
-		break;
-#ifdef USE_HQ_SCALERS
-	case GFX_HQ2X:
-		newScalerProc = HQ2x;
-		break;
-	case GFX_HQ3X:
-		newScalerProc = HQ3x;
-		break;
-#endif
-	case GFX_TV2X:
-		newScalerProc = TV2x;
-		break;
-	case GFX_DOTMATRIX:
-		newScalerProc = DotMatrix;
-		break;
-#endif // USE_SCALERS
-	default:
-		break;
-	}
-
-	return newScalerProc;
+	const ScalerImplementation *impl = selectScalerImplementation(getGraphicsScalerDescriptor(mode));
+	return impl ? impl->proc : nullptr;
 }
 
 void SurfaceSdlGraphicsManager::setGraphicsModeIntern() {
@@ -702,6 +636,9 @@ void SurfaceSdlGraphicsManager::setGraphicsModeIntern() {
 
 	_scalerProc = newScalerProc;
 
+	const ScalerImplementation *impl = selectScalerImplementation(getGraphicsScalerDescriptor(_videoMode.mode));
+	_scalerThreadSafe = impl && impl->proc == newScalerProc && impl->threadSafe;
+
 	if (_videoMode.mode != GFX_NORMAL) {
 		for (int i = 0; i < ARRAYSIZE(s_gfxModeSwitchTable); i++) {
 			if (s_gfxModeSwitchTable[i][1] == _videoMode.mode || s_gfxModeSwitchTable[i][2] == _videoMode.mode) {
@@ -1140,6 +1077,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 	SDL_Surface *srcSurf, *origSurf;
 	int height, width;
 	ScalerProc *scalerProc;
+	bool scalerThreadSafe;
 	int scale1;
 
 	// If there's an active debugger, update it
@@ -1197,6 +1135,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		width = _videoMode.screenWidth;
 		height = _videoMode.screenHeight;
 		scalerProc = _scalerProc;
+		scalerThreadSafe = _scalerThreadSafe;
 		scale1 = _videoMode.scaleFactor;
 	} else {
 		origSurf = _overlayscreen;
@@ -1204,6 +1143,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		width = _videoMode.overlayWidth;
 		height = _videoMode.overlayHeight;
 		scalerProc = Normal1x;
+		scalerThreadSafe = true;
 
 		scale1 = 1;
 	}
@@ -1278,7 +1218,8 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 					dst_y = real2Aspect(dst_y);
 
 				assert(scalerProc != NULL);
-				scalerProc((byte *)srcSurf->pixels + (r->x * 2 + 2) + (r->y + 1) * srcPitch, srcPitch,
+				_scalerPool.scale(scalerProc, scalerThreadSafe, scale1,
+					(byte *)srcSurf->pixels + (r->x * 2 + 2) + (r->y + 1) * srcPitch, srcPitch,
 					(byte *)_hwScreen->pixels + dst_x * 2 + dst_y * dstPitch, dstPitch, dst_w, dst_h);
 			}
 
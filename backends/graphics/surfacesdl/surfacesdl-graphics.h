@@ -25,6 +25,7 @@
 
 #include "backends/graphics/graphics.h"
 #include "backends/graphics/sdl/sdl-graphics.h"
+#include "backends/graphics/surfacesdl/surfacesdl-scalerpool.h"
 #include "graphics/pixelformat.h"
 #include "graphics/scaler.h"
 #include "common/events.h"
@@ -182,6 +183,7 @@ protected:
 
 	virtual int getGraphicsModeScale(int mode) const override;
 	virtual ScalerProc *getGraphicsScalerProc(int mode) const;
+	const ScalerDescriptor *getGraphicsScalerDescriptor(int mode) const;
 
 	virtual void setupHardwareSize();
 
@@ -323,7 +325,9 @@ protected:
 #endif
 
 	ScalerProc *_scalerProc;
+	bool _scalerThreadSafe;
 	int _scalerType;
+	SdlScalerPool _scalerPool;
 	int _transactionMode;
 
 	// Indicates whether it is needed to free _hwSurface in destructor
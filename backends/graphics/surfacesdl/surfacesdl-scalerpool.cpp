@@ -0,0 +1,138 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/graphics/surfacesdl/surfacesdl-scalerpool.h"
+
+#include "common/debug.h"
+#include "common/textconsole.h"
+
+SdlScalerPool::SdlScalerPool() : _done(nullptr), _quit(false) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	int numWorkers = SDL_GetCPUCount() - 1;
+	if (numWorkers > kMaxWorkers)
+		numWorkers = kMaxWorkers;
+	if (numWorkers <= 0)
+		return;
+
+	_done = SDL_CreateSemaphore(0);
+	if (!_done) {
+		warning("Could not create scaler semaphore: %s", SDL_GetError());
+		return;
+	}
+
+	for (int i = 0; i < numWorkers; ++i) {
+		Worker *worker = new Worker();
+		worker->pool = this;
+		worker->start = SDL_CreateSemaphore(0);
+		worker->thread = nullptr;
+		if (worker->start)
+			worker->thread = SDL_CreateThread(&workerMain, "ScummVM scaler", worker);
+
+		if (!worker->thread) {
+			warning("Could not create scaler thread: %s", SDL_GetError());
+			if (worker->start)
+				SDL_DestroySemaphore(worker->start);
+			delete worker;
+			break;
+		}
+
+		_workers.push_back(worker);
+	}
+
+	debug(1, "Using %u threads for scaling", getThreadCount());
+#endif
+}
+
+SdlScalerPool::~SdlScalerPool() {
+	_quit = true;
+
+	for (uint i = 0; i < _workers.size(); ++i) {
+		SDL_SemPost(_workers[i]->start);
+		SDL_WaitThread(_workers[i]->thread, nullptr);
+		SDL_DestroySemaphore(_workers[i]->start);
+		delete _workers[i];
+	}
+
+	if (_done)
+		SDL_DestroySemaphore(_done);
+}
+
+int SdlScalerPool::workerMain(void *data) {
+	Worker *worker = (Worker *)data;
+
+	while (true) {
+		SDL_SemWait(worker->start);
+		if (worker->pool->_quit)
+			break;
+
+		worker->band.run();
+		SDL_SemPost(worker->pool->_done);
+	}
+
+	return 0;
+}
+
+void SdlScalerPool::scale(ScalerProc *scalerProc, bool threadSafe, int scaleFactor,
+                          const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
+	int numBands = height / kMinBandHeight;
+	if (numBands > (int)getThreadCount())
+		numBands = getThreadCount();
+
+	if (!threadSafe || scaleFactor <= 1 || numBands < 2) {
+		scalerProc(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+		return;
+	}
+
+	// Keep band boundaries on even rows, so that scalers with a row based
+	// pattern (TV2x, DotMatrix) produce the same output as a single call.
+	const int bandHeight = (height / numBands) & ~1;
+
+	Band band;
+	band.scalerProc = scalerProc;
+	band.srcPitch = srcPitch;
+	band.dstPitch = dstPitch;
+	band.width = width;
+
+	for (int i = 0; i < numBands; ++i) {
+		const int y = i * bandHeight;
+		band.srcPtr = srcPtr + y * srcPitch;
+		band.dstPtr = dstPtr + y * scaleFactor * dstPitch;
+		band.height = (i == numBands - 1) ? height - y : bandHeight;
+
+		if (i == numBands - 1) {
+			// The last band is scaled on the calling thread
+			band.run();
+		} else {
+			_workers[i]->band = band;
+			SDL_SemPost(_workers[i]->start);
+		}
+	}
+
+	for (int i = 0; i < numBands - 1; ++i)
+		SDL_SemWait(_done);
+}
+
+#endif
@@ -0,0 +1,95 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_SURFACESDL_SCALERPOOL_H
+#define BACKENDS_GRAPHICS_SURFACESDL_SCALERPOOL_H
+
+#include "graphics/scaler.h"
+#include "common/array.h"
+
+#include "backends/platform/sdl/sdl-sys.h"
+
+/**
+ * Runs a scaler over a rectangle using a small pool of SDL worker threads.
+ *
+ * The rectangle is split into horizontal bands which are scaled
+ * concurrently, the calling thread taking care of the last band itself.
+ * Scalers only ever read the source buffer, so the rows above and below
+ * each band that are needed by the filtering scalers are simply read from
+ * the neighbouring bands' source rows; destination bands never overlap.
+ *
+ * Without SDL 2 (or on single core machines) no workers are created and
+ * everything is done on the calling thread.
+ */
+class SdlScalerPool {
+public:
+	SdlScalerPool();
+	~SdlScalerPool();
+
+	/**
+	 * Scale a rectangle. The arguments match those of ScalerProc, with
+	 * scaleFactor being the number of destination rows produced per source
+	 * row.
+	 *
+	 * @param threadSafe	whether scalerProc may be called concurrently
+	 */
+	void scale(ScalerProc *scalerProc, bool threadSafe, int scaleFactor,
+	           const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height);
+
+	/** Number of threads (including the calling one) used for scaling. */
+	uint getThreadCount() const { return _workers.size() + 1; }
+
+private:
+	enum {
+		/** Bands are never made smaller than this number of source rows. */
+		kMinBandHeight = 16,
+		/** Upper limit for the number of worker threads. */
+		kMaxWorkers = 7
+	};
+
+	struct Band {
+		ScalerProc *scalerProc;
+		const uint8 *srcPtr;
+		uint32 srcPitch;
+		uint8 *dstPtr;
+		uint32 dstPitch;
+		int width;
+		int height;
+
+		void run() const { scalerProc(srcPtr, srcPitch, dstPtr, dstPitch, width, height); }
+	};
+
+	struct Worker {
+		SdlScalerPool *pool;
+		SDL_Thread *thread;
+		SDL_sem *start;
+		Band band;
+	};
+
+	static int workerMain(void *data);
+
+	Common::Array<Worker *> _workers;
+	SDL_sem *_done;
+	bool _quit;
+};
+
+#endif
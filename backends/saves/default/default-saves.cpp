@@ -171,7 +171,17 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 	Common::WriteStream *const sf = fileNode.createWriteStream();
 	if (!sf)
 		return nullptr;
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	Common::WriteStream *stream = sf;
+	if (compress) {
+		// The chunked format allows random access to the saved data, but
+		// cannot be read by older versions, so it needs to be enabled
+		// explicitly.
+		if (ConfMan.hasKey("chunked_saves") && ConfMan.getBool("chunked_saves"))
+			stream = Common::wrapChunkedCompressedWriteStream(sf);
+		else
+			stream = Common::wrapCompressedWriteStream(sf);
+	}
+	Common::OutSaveFile *const result = new Common::OutSaveFile(stream);
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
@@ -24,6 +24,8 @@
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
 #include "common/zlib.h"
+#include "common/array.h"
+#include "common/endian.h"
 #include "common/ptr.h"
 #include "common/util.h"
 #include "common/stream.h"
@@ -49,6 +51,26 @@
 
 namespace Common {
 
+/**
+ * Layout of the chunked compression container. The uncompressed data is
+ * split into chunks of a fixed size which are deflated independently, so
+ * any part of the data can be read by inflating a single chunk.
+ *
+ *   header:  uint32 magic ('SVMZ'), uint32 version, uint32 chunk size
+ *   chunks:  zlib compressed chunks, stored back to back
+ *   index:   uint32 compressed size of each chunk
+ *   trailer: uint32 chunk count, uint32 uncompressed size, uint32 magic
+ *
+ * All values are big endian. The trailer is at a fixed distance from the
+ * end of the file, which allows locating the index without a scan.
+ */
+enum {
+	kChunkedZlibMagic = MKTAG('S', 'V', 'M', 'Z'),
+	kChunkedZlibVersion = 1,
+	kChunkedZlibHeaderSize = 12,
+	kChunkedZlibTrailerSize = 12
+};
+
 #if defined(USE_ZLIB)
 
 bool uncompress(byte *dst, unsigned long *dstLen, const byte *src, unsigned long srcLen) {
@@ -490,10 +512,289 @@ public:
 	virtual int32 pos() const { return _pos; }
 };
 
+/**
+ * A wrapper class providing on-the-fly decompression of a stream in the
+ * chunked compression format. Seeking is cheap in both directions since
+ * at most one chunk has to be inflated.
+ */
+class ChunkedZlibReadStream : public SeekableReadStream {
+protected:
+	ScopedPtr<SeekableReadStream> _wrapped;
+	Array<uint32> _chunkOffsets;
+	Array<uint32> _chunkSizes;
+	uint32 _chunkSize;
+	uint32 _origSize;
+
+	byte *_chunk;
+	int32 _curChunk;
+	uint32 _curChunkSize;
+
+	uint32 _pos;
+	bool _eos;
+	bool _err;
+
+	bool loadChunk(uint32 chunk) {
+		if ((int32)chunk == _curChunk)
+			return true;
+
+		_curChunk = -1;
+
+		byte *compressed = (byte *)malloc(_chunkSizes[chunk]);
+		if (!compressed)
+			return false;
+
+		if (!_wrapped->seek(_chunkOffsets[chunk], SEEK_SET) ||
+		    _wrapped->read(compressed, _chunkSizes[chunk]) != _chunkSizes[chunk]) {
+			free(compressed);
+			return false;
+		}
+
+		unsigned long size = _chunkSize;
+		const bool success = Common::uncompress(_chunk, &size, compressed, _chunkSizes[chunk]);
+		free(compressed);
+		if (!success)
+			return false;
+
+		_curChunk = chunk;
+		_curChunkSize = size;
+		return true;
+	}
+
+public:
+	ChunkedZlibReadStream(SeekableReadStream *w) : _wrapped(w), _chunkSize(0), _origSize(0),
+			_chunk(nullptr), _curChunk(-1), _curChunkSize(0), _pos(0), _eos(false), _err(true) {
+		assert(w != nullptr);
+
+		w->seek(0, SEEK_SET);
+		const uint32 magic = w->readUint32BE();
+		const uint32 version = w->readUint32BE();
+		_chunkSize = w->readUint32BE();
+		if (magic != kChunkedZlibMagic || version != kChunkedZlibVersion || _chunkSize == 0)
+			return;
+
+		w->seek(-kChunkedZlibTrailerSize, SEEK_END);
+		const uint32 numChunks = w->readUint32BE();
+		_origSize = w->readUint32BE();
+		if (w->readUint32BE() != kChunkedZlibMagic || w->err())
+			return;
+
+		if (numChunks != (_origSize + _chunkSize - 1) / _chunkSize || numChunks > (uint32)w->size() / 4)
+			return;
+
+		const int32 indexPos = w->size() - kChunkedZlibTrailerSize - (int32)(numChunks * 4);
+		if (indexPos < kChunkedZlibHeaderSize)
+			return;
+
+		w->seek(indexPos, SEEK_SET);
+		_chunkOffsets.resize(numChunks);
+		_chunkSizes.resize(numChunks);
+		uint32 offset = kChunkedZlibHeaderSize;
+		for (uint32 i = 0; i < numChunks; ++i) {
+			_chunkOffsets[i] = offset;
+			_chunkSizes[i] = w->readUint32BE();
+			offset += _chunkSizes[i];
+		}
+		if (offset != (uint32)indexPos || w->err())
+			return;
+
+		_chunk = (byte *)malloc(_chunkSize);
+		_err = (_chunk == nullptr);
+	}
+
+	~ChunkedZlibReadStream() {
+		free(_chunk);
+	}
+
+	bool err() const { return _err; }
+	void clearErr() {
+		// only reset _eos; I/O errors are not recoverable
+		_eos = false;
+	}
+
+	uint32 read(void *dataPtr, uint32 dataSize) {
+		byte *dst = (byte *)dataPtr;
+		uint32 total = 0;
+
+		while (!_err && total < dataSize) {
+			if (_pos >= _origSize) {
+				_eos = true;
+				break;
+			}
+
+			const uint32 chunk = _pos / _chunkSize;
+			if (!loadChunk(chunk)) {
+				_err = true;
+				break;
+			}
+
+			const uint32 chunkPos = _pos - chunk * _chunkSize;
+			if (chunkPos >= _curChunkSize) {
+				_err = true;
+				break;
+			}
+
+			const uint32 len = MIN(dataSize - total, _curChunkSize - chunkPos);
+			memcpy(dst + total, _chunk + chunkPos, len);
+			total += len;
+			_pos += len;
+		}
+
+		return total;
+	}
+
+	bool eos() const { return _eos; }
+	int32 pos() const { return _pos; }
+	int32 size() const { return _origSize; }
+
+	bool seek(int32 offset, int whence = SEEK_SET) {
+		int32 newPos = 0;
+		switch (whence) {
+		default:
+			// fallthrough intended
+		case SEEK_SET:
+			newPos = offset;
+			break;
+		case SEEK_CUR:
+			newPos = _pos + offset;
+			break;
+		case SEEK_END:
+			newPos = _origSize + offset;
+			break;
+		}
+
+		if (newPos < 0 || (uint32)newPos > _origSize)
+			return false;
+
+		_pos = newPos;
+		_eos = false;
+		return true;
+	}
+};
+
+/**
+ * A wrapper class providing on-the-fly compression into the chunked
+ * compression format. Each chunk is compressed as soon as it is filled,
+ * the index is written by finalize().
+ */
+class ChunkedZlibWriteStream : public WriteStream {
+protected:
+	ScopedPtr<WriteStream> _wrapped;
+	Array<uint32> _chunkSizes;
+	uint32 _chunkSize;
+	byte *_chunk;
+	uint32 _chunkFill;
+	uint32 _pos;
+	bool _err;
+	bool _finalized;
+
+	void flushChunk() {
+		if (_err || _chunkFill == 0)
+			return;
+
+		unsigned long compressedSize = compressBound(_chunkFill);
+		byte *compressed = (byte *)malloc(compressedSize);
+		if (!compressed || compress2(compressed, &compressedSize, _chunk, _chunkFill, Z_DEFAULT_COMPRESSION) != Z_OK ||
+		    _wrapped->write(compressed, compressedSize) != compressedSize) {
+			_err = true;
+		} else {
+			_chunkSizes.push_back(compressedSize);
+		}
+
+		free(compressed);
+		_chunkFill = 0;
+	}
+
+public:
+	ChunkedZlibWriteStream(WriteStream *w, uint32 chunkSize) : _wrapped(w), _chunkSize(chunkSize),
+			_chunk(nullptr), _chunkFill(0), _pos(0), _err(false), _finalized(false) {
+		assert(w != nullptr);
+		assert(chunkSize > 0);
+
+		_chunk = (byte *)malloc(_chunkSize);
+		if (!_chunk) {
+			_err = true;
+			return;
+		}
+
+		_wrapped->writeUint32BE(kChunkedZlibMagic);
+		_wrapped->writeUint32BE(kChunkedZlibVersion);
+		_wrapped->writeUint32BE(_chunkSize);
+	}
+
+	~ChunkedZlibWriteStream() {
+		finalize();
+		free(_chunk);
+	}
+
+	bool err() const { return _err || _wrapped->err(); }
+
+	void clearErr() {
+		_wrapped->clearErr();
+	}
+
+	void finalize() {
+		if (_finalized)
+			return;
+		_finalized = true;
+
+		flushChunk();
+		if (!_err) {
+			for (uint i = 0; i < _chunkSizes.size(); ++i)
+				_wrapped->writeUint32BE(_chunkSizes[i]);
+			_wrapped->writeUint32BE(_chunkSizes.size());
+			_wrapped->writeUint32BE(_pos);
+			_wrapped->writeUint32BE(kChunkedZlibMagic);
+		}
+
+		// Finalize the wrapped savefile, too
+		_wrapped->finalize();
+	}
+
+	uint32 write(const void *dataPtr, uint32 dataSize) {
+		if (err() || _finalized)
+			return 0;
+
+		const byte *src = (const byte *)dataPtr;
+		uint32 written = 0;
+		while (written < dataSize && !_err) {
+			const uint32 len = MIN(dataSize - written, _chunkSize - _chunkFill);
+			memcpy(_chunk + _chunkFill, src + written, len);
+			_chunkFill += len;
+			written += len;
+
+			if (_chunkFill == _chunkSize)
+				flushChunk();
+		}
+
+		_pos += written;
+		return written;
+	}
+
+	virtual int32 pos() const { return _pos; }
+};
+
 #endif	// USE_ZLIB
 
 SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, uint32 knownSize) {
 	if (toBeWrapped) {
+		const int32 startPos = toBeWrapped->pos();
+		uint32 magic = toBeWrapped->readUint32BE();
+		toBeWrapped->seek(startPos, SEEK_SET);
+		if (magic == kChunkedZlibMagic) {
+#if defined(USE_ZLIB)
+			ChunkedZlibReadStream *stream = new ChunkedZlibReadStream(toBeWrapped);
+			if (stream->err()) {
+				warning("wrapCompressedReadStream: Invalid chunked compressed stream");
+				delete stream;
+				return nullptr;
+			}
+			return stream;
+#else
+			delete toBeWrapped;
+			return NULL;
+#endif
+		}
+
 		uint16 header = toBeWrapped->readUint16BE();
 		bool isCompressed = (header == 0x1F8B ||
 				     ((header & 0x0F00) == 0x0800 &&
@@ -519,5 +820,13 @@ WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped) {
 	return toBeWrapped;
 }
 
+WriteStream *wrapChunkedCompressedWriteStream(WriteStream *toBeWrapped, uint32 chunkSize) {
+#if defined(USE_ZLIB)
+	if (toBeWrapped)
+		return new ChunkedZlibWriteStream(toBeWrapped, chunkSize);
+#endif
+	return toBeWrapped;
+}
+
 
 } // End of namespace Common
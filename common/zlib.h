@@ -122,9 +122,10 @@ bool inflateZlibHeaderless(Common::WriteStream *dst, Common::SeekableReadStream
 /**
  * Take an arbitrary SeekableReadStream and wrap it in a custom stream which
  * provides transparent on-the-fly decompression. Assumes the data it
- * retrieves from the wrapped stream to be either uncompressed or in gzip
- * format. In the former case, the original stream is returned unmodified
- * (and in particular, not wrapped). In the latter case the stream is
+ * retrieves from the wrapped stream to be either uncompressed, in gzip
+ * format or in the chunked format written by wrapChunkedCompressedWriteStream.
+ * In the former case, the original stream is returned unmodified
+ * (and in particular, not wrapped). In the latter cases the stream is
  * returned wrapped, unless there is no ZLIB support, then NULL is returned
  * and the old stream is destroyed.
  *
@@ -154,6 +155,22 @@ SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, ui
  */
 WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped);
 
+/**
+ * Take an arbitrary WriteStream and wrap it in a custom stream which provides
+ * transparent on-the-fly compression into a chunked format: the data is split
+ * into chunks of chunkSize bytes which are compressed independently, followed
+ * by an index. Streams in this format are recognized by
+ * wrapCompressedReadStream and can be seeked without decompressing the data
+ * in front of the requested position, e.g. to read a savegame header or
+ * thumbnail only.
+ * Without ZLIB support the given stream is returned unmodified.
+ * The created stream also becomes responsible for freeing the passed stream.
+ *
+ * It is safe to call this with a NULL parameter (in this case, NULL is
+ * returned).
+ */
+WriteStream *wrapChunkedCompressedWriteStream(WriteStream *toBeWrapped, uint32 chunkSize = 65536);
+
 /** @} */
 
 } // End of namespace Common
@@ -203,6 +203,9 @@ void MainMenuDialog::reflowLayout() {
 }
 
 void MainMenuDialog::save() {
+	// Make sure the save list does not show partially written saves
+	_engine->waitForPendingSaves();
+
 	int slot = _saveDialog->runModalWithCurrentTarget();
 
 	if (slot >= 0) {
@@ -226,6 +229,8 @@ void MainMenuDialog::save() {
 }
 
 void MainMenuDialog::load() {
+	_engine->waitForPendingSaves();
+
 	int slot = _loadDialog->runModalWithCurrentTarget();
 
 	_engine->setGameToLoadSlot(slot);
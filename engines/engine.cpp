@@ -32,6 +32,7 @@
 #include "engines/dialogs.h"
 #include "engines/util.h"
 #include "engines/metaengine.h"
+#include "engines/savewriter.h"
 
 #include "common/config-manager.h"
 #include "common/events.h"
@@ -151,7 +152,8 @@ Engine::Engine(OSystem *syst)
 		_mainMenuDialog(NULL),
 		_debugger(NULL),
 		_autosaveInterval(ConfMan.getInt("autosave_period")),
-		_lastAutosaveTime(_system->getMillis()) {
+		_lastAutosaveTime(_system->getMillis()),
+		_saveWriter(nullptr) {
 
 	g_engine = this;
 	Common::setErrorOutputFormatter(defaultOutputFormatter);
@@ -183,6 +185,9 @@ Engine::Engine(OSystem *syst)
 }
 
 Engine::~Engine() {
+	// Write out any pending background saves before quitting
+	delete _saveWriter;
+
 	_mixer->stopAll();
 
 	delete _debugger;
@@ -526,6 +531,10 @@ void Engine::checkCD() {
 }
 
 void Engine::handleAutoSave() {
+	// Write the next part of a pending background save
+	if (_saveWriter)
+		_saveWriter->update(_system->getMillis());
+
 	const int diff = _system->getMillis() - _lastAutosaveTime;
 
 	if (_autosaveInterval != 0 && diff > (_autosaveInterval * 1000)) {
@@ -539,13 +548,15 @@ void Engine::saveAutosaveIfEnabled() {
 		bool saveFlag = canSaveAutosaveCurrently();
 
 		if (saveFlag) {
+			waitForPendingSaves();
+
 			// First check for an existing savegame in the slot, and if present, if it's an autosave
 			SaveStateDescriptor desc = getMetaEngine().querySaveMetaInfos(
 				_targetName.c_str(), getAutosaveSlot());
 			saveFlag = desc.getSaveSlot() == -1 || desc.isAutosave();
 		}
 
-		if (saveFlag && saveGameState(getAutosaveSlot(), Common::convertFromU32String(_("Autosave")), true).getCode() != Common::kNoError) {
+		if (saveFlag && saveGameStateInBackground(getAutosaveSlot(), Common::convertFromU32String(_("Autosave")), true).getCode() != Common::kNoError) {
 			// Couldn't autosave at the designated time
 			g_system->displayMessageOnOSD(_("Error occurred making autosave"));
 			saveFlag = false;
@@ -739,6 +750,7 @@ void Engine::flipMute() {
 Common::Error Engine::loadGameState(int slot) {
 	// In case autosaves are on, do a save first before loading the new save
 	saveAutosaveIfEnabled();
+	waitForPendingSaves();
 
 	Common::InSaveFile *saveFile = _saveFileMan->openForLoading(getSaveStateName(slot));
 
@@ -767,6 +779,8 @@ bool Engine::canLoadGameStateCurrently() {
 }
 
 Common::Error Engine::saveGameState(int slot, const Common::String &desc, bool isAutosave) {
+	waitForPendingSaves();
+
 	Common::OutSaveFile *saveFile = _saveFileMan->openForSaving(getSaveStateName(slot));
 
 	if (!saveFile)
@@ -788,6 +802,48 @@ Common::Error Engine::saveGameStream(Common::WriteStream *stream, bool isAutosav
 	return Common::kWritingFailed;
 }
 
+Common::Error Engine::saveGameStateInBackground(int slot, const Common::String &desc, bool isAutosave) {
+	if (!hasFeature(kSupportsBackgroundSaving))
+		return saveGameState(slot, desc, isAutosave);
+
+	// Serialize the game state into memory first. The OutSaveFile wrapper
+	// deletes the memory stream, but leaves the buffer to us.
+	Common::MemoryWriteStreamDynamic *memStream = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+	Common::OutSaveFile snapshot(memStream);
+
+	Common::Error result = saveGameStream(&snapshot, isAutosave);
+	if (result.getCode() == Common::kNoError)
+		MetaEngine::appendExtendedSave(&snapshot, getTotalPlayTime() / 1000, desc, isAutosave);
+
+	byte *data = memStream->getData();
+	uint32 size = memStream->size();
+
+	if (result.getCode() != Common::kNoError) {
+		free(data);
+		return result;
+	}
+
+	// Opening the file is cheap. The compression and the actual writing
+	// are spread over the following event polls by the background writer.
+	waitForPendingSaves();
+	Common::OutSaveFile *saveFile = _saveFileMan->openForSaving(getSaveStateName(slot));
+	if (!saveFile) {
+		free(data);
+		return Common::kWritingFailed;
+	}
+
+	if (!_saveWriter)
+		_saveWriter = new BackgroundSaveWriter();
+	_saveWriter->queue(saveFile, data, size);
+
+	return Common::kNoError;
+}
+
+void Engine::waitForPendingSaves() {
+	if (_saveWriter)
+		_saveWriter->flush();
+}
+
 bool Engine::canSaveGameStateCurrently() {
 	// Do not allow saving by default
 	return false;
@@ -799,6 +855,8 @@ bool Engine::loadGameDialog() {
 		return false;
 	}
 
+	waitForPendingSaves();
+
 	GUI::SaveLoadChooser *dialog = new GUI::SaveLoadChooser(_("Load game:"), _("Load"), false);
 
 	int slotNum;
@@ -828,6 +886,8 @@ bool Engine::saveGameDialog() {
 		return false;
 	}
 
+	waitForPendingSaves();
+
 	GUI::SaveLoadChooser *dialog = new GUI::SaveLoadChooser(_("Save game:"), _("Save"), true);
 	int slotNum;
 	{
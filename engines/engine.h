@@ -33,6 +33,7 @@
 class OSystem;
 class MetaEngineDetection;
 class MetaEngine;
+class BackgroundSaveWriter;
 
 namespace Audio {
 class Mixer;
@@ -205,6 +206,11 @@ private:
 	 */
 	int _lastAutosaveTime;
 
+	/**
+	 * Writer used by saveGameStateInBackground(). Created on first use.
+	 */
+	BackgroundSaveWriter *_saveWriter;
+
 	/**
 	 * Save slot selected via the global main menu.
 	 *
@@ -277,7 +283,17 @@ public:
 		 * The engine will need to read the actual resolution used by the
 		 * backend using OSystem::getWidth and OSystem::getHeight.
 		 */
-		kSupportsArbitraryResolutions
+		kSupportsArbitraryResolutions,
+
+		/**
+		 * Saving in the background is supported.
+		 *
+		 * This means that the engine implements saveGameStream() and that
+		 * any saveGameState() override does nothing more for autosaves.
+		 * Autosaves are then serialized into memory and written to disk by
+		 * a background writer.
+		 */
+		kSupportsBackgroundSaving
 	};
 
 
@@ -440,6 +456,28 @@ public:
 	 */
 	virtual Common::Error saveGameStream(Common::WriteStream *stream, bool isAutosave = false);
 
+	/**
+	 * Save a game state without blocking on compression and disk access.
+	 *
+	 * The game state is serialized into memory using saveGameStream(), and
+	 * the data is then compressed and written to the save file in the
+	 * background. Engines that do not support kSupportsBackgroundSaving
+	 * are saved synchronously using saveGameState().
+	 *
+	 * @param slot        The slot into which the save state should be stored.
+	 * @param desc        Description for the save state.
+	 * @param isAutosave  Expected to be true if an autosave is being created.
+	 *
+	 * @return kNoError if the save state was serialized, otherwise an error code.
+	 */
+	Common::Error saveGameStateInBackground(int slot, const Common::String &desc, bool isAutosave = false);
+
+	/**
+	 * Wait until all saves started with saveGameStateInBackground() have
+	 * been written to disk.
+	 */
+	void waitForPendingSaves();
+
 	/**
 	 * Indicate whether a game state can be saved.
 	 */
@@ -580,6 +618,9 @@ public:
 
 	/**
 	 * Check whether it is time to autosave, and if so, do it.
+	 *
+	 * This also writes the next slice of any save started with
+	 * saveGameStateInBackground().
 	 */
 	void handleAutoSave();
 
@@ -30,6 +30,7 @@ void Glulx::execute_loop() {
 	int ix;
 	uint opcode;
 	const operandlist_t *oplist;
+	decodedinst_t *inst_entry;
 	oparg_t inst[MAX_OPERANDS];
 	uint value, addr, val0, val1;
 	int vals0, vals1;
@@ -49,44 +50,62 @@ void Glulx::execute_loop() {
 		/* Stash the current opcode's address, in case the interpreter needs to serialize the VM state out-of-band. */
 		prevpc = pc;
 
-		/* Fetch the opcode number. */
-		opcode = Mem1(pc);
-		pc++;
-		if (opcode & 0x80) {
-			/* More than one-byte opcode. */
-			if (opcode & 0x40) {
-				/* Four-byte opcode */
-				opcode &= 0x3F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-			} else {
-				/* Two-byte opcode */
-				opcode &= 0x7F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
+		/* Instructions in ROM can't change, so they only need decoding once. */
+		inst_entry = &instcache[pc & (INSTCACHE_SIZE - 1)];
+		if (inst_entry->addr == pc) {
+			opcode = inst_entry->opcode;
+			oplist = inst_entry->oplist;
+			load_operands(inst, inst_entry->operands, oplist);
+			pc = inst_entry->nextpc;
+		} else {
+			/* Fetch the opcode number. */
+			opcode = Mem1(pc);
+			pc++;
+			if (opcode & 0x80) {
+				/* More than one-byte opcode. */
+				if (opcode & 0x40) {
+					/* Four-byte opcode */
+					opcode &= 0x3F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				} else {
+					/* Two-byte opcode */
+					opcode &= 0x7F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				}
 			}
-		}
-
-		/* Now we have an opcode number. */
 
-		/* Fetch the structure that describes how the operands for this
-		   opcode are arranged. This is a pointer to an immutable,
-		   static object. */
-		if (opcode < 0x80)
-			oplist = fast_operandlist[opcode];
-		else
-			oplist = lookup_operandlist(opcode);
-
-		if (!oplist)
-			fatal_error_i("Encountered unknown opcode.", opcode);
-
-		/* Based on the oplist structure, load the actual operand values
-		   into inst. This moves the PC up to the end of the instruction. */
-		parse_operands(inst, oplist);
+			/* Now we have an opcode number. */
+
+			/* Fetch the structure that describes how the operands for this
+			   opcode are arranged. This is a pointer to an immutable,
+			   static object. */
+			if (opcode < 0x80)
+				oplist = fast_operandlist[opcode];
+			else
+				oplist = lookup_operandlist(opcode);
+
+			if (!oplist)
+				fatal_error_i("Encountered unknown opcode.", opcode);
+
+			/* Based on the oplist structure, load the actual operand values
+			   into inst. This moves the PC up to the end of the instruction. */
+			inst_entry->addr = INSTCACHE_EMPTY;
+			decode_operands(inst_entry->operands, oplist);
+			load_operands(inst, inst_entry->operands, oplist);
+
+			if (pc <= ramstart) {
+				inst_entry->addr = prevpc;
+				inst_entry->nextpc = pc;
+				inst_entry->opcode = opcode;
+				inst_entry->oplist = oplist;
+			}
+		}
 
 		/* Perform the opcode. This switch statement is split in two, based
 		   on some paranoid suspicions about the ability of compilers to
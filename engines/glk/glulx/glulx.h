@@ -146,6 +146,13 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Direct-mapped cache of decoded ROM instructions, indexed by the low bits of the
+	 * instruction address. This saves re-parsing the opcode and operand modes of the
+	 * instructions in hot loops.
+	 */
+	decodedinst_t instcache[INSTCACHE_SIZE];
+
 	/**@}*/
 
 	/**
@@ -537,6 +544,11 @@ public:
 	 */
 	void init_operands();
 
+	/**
+	 * Empty the decoded instruction cache.
+	 */
+	void clear_instcache();
+
 	/**
 	 * Return the operandlist for a given opcode. For opcodes in the range 00..7F, it's faster
 	 * to use the array fast_operandlist[].
@@ -552,6 +564,18 @@ public:
 	*/
 	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
 
+	/**
+	 * Read the addressing modes of an instruction's operands, along with any constants or
+	 * addresses that follow them, without fetching the operand values. Like parse_operands,
+	 * this moves the PC to the beginning of the next instruction.
+	 */
+	void decode_operands(decodedop_t *ops, const operandlist_t *oplist);
+
+	/**
+	 * Fetch the values of previously decoded operands, and put them in args.
+	 */
+	void load_operands(oparg_t *args, const decodedop_t *ops, const operandlist_t *oplist);
+
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
 	 * the result of an opcode, but it's also used by any code that pulls a call-stub off the stack.
@@ -352,6 +352,43 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * How a decoded operand is fetched. Store operands use the desttype values of oparg_t instead.
+ */
+enum opmode {
+	opmode_Const = 0,       ///< value is the constant itself
+	opmode_Stack = 1,       ///< pop the value off the stack
+	opmode_Mem = 2,         ///< value is an absolute main memory address
+	opmode_Locals = 3       ///< value is an offset into the locals segment
+};
+
+/**
+ * One operand of a decoded instruction: the addressing mode together with whatever constant
+ * or address followed it in the instruction.
+ */
+struct decodedop_struct {
+	uint mode;
+	uint value;
+};
+typedef decodedop_struct decodedop_t;
+
+/**
+ * An instruction whose opcode and operand modes have already been decoded, as kept in the
+ * instruction cache. Only instructions lying wholly in ROM are cached, since ROM cannot change
+ * while the game runs.
+ */
+struct decodedinst_struct {
+	uint addr;              ///< Address of the instruction, or INSTCACHE_EMPTY
+	uint nextpc;            ///< Address of the following instruction
+	uint opcode;
+	const operandlist_t *oplist;
+	decodedop_t operands[MAX_OPERANDS];
+};
+typedef decodedinst_struct decodedinst_t;
+
+#define INSTCACHE_SIZE (4096)
+#define INSTCACHE_EMPTY (0xFFFFFFFF)
+
 typedef uint(Glulx::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
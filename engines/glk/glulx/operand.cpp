@@ -67,6 +67,8 @@ static const operandlist_t list_LLSS = { 4, 4, &array_LLSS[0] };
 void Glulx::init_operands() {
 	for (int ix = 0; ix < 0x80; ix++)
 		fast_operandlist[ix] = lookup_operandlist(ix);
+
+	clear_instcache();
 }
 
 const operandlist_t *Glulx::lookup_operandlist(uint opcode) {
@@ -280,23 +282,31 @@ const operandlist_t *Glulx::lookup_operandlist(uint opcode) {
 	}
 }
 
+void Glulx::clear_instcache() {
+	for (int ix = 0; ix < INSTCACHE_SIZE; ix++)
+		instcache[ix].addr = INSTCACHE_EMPTY;
+}
+
 void Glulx::parse_operands(oparg_t *args, const operandlist_t *oplist) {
+	decodedop_t ops[MAX_OPERANDS];
+
+	decode_operands(ops, oplist);
+	load_operands(args, ops, oplist);
+}
+
+void Glulx::decode_operands(decodedop_t *ops, const operandlist_t *oplist) {
 	int ix;
-	oparg_t *curarg;
+	decodedop_t *curop;
 	int numops = oplist->num_ops;
-	int argsize = oplist->arg_size;
 	uint modeaddr = pc;
 	int modeval = 0;
 
 	pc += (numops + 1) / 2;
 
-	for (ix = 0, curarg = args; ix < numops; ix++, curarg++) {
+	for (ix = 0, curop = ops; ix < numops; ix++, curop++) {
 		int mode;
-		uint value;
 		uint addr;
 
-		curarg->desttype = 0;
-
 		if ((ix & 1) == 0) {
 			modeval = Mem1(modeaddr);
 			mode = (modeval & 0x0F);
@@ -310,35 +320,36 @@ void Glulx::parse_operands(oparg_t *args, const operandlist_t *oplist) {
 			switch (mode) {
 
 			case 8: /* pop off stack */
-				if (stackptr < valstackbase + 4) {
-					fatal_error("Stack underflow in operand.");
-				}
-				stackptr -= 4;
-				value = Stk4(stackptr);
+				curop->mode = opmode_Stack;
+				curop->value = 0;
 				break;
 
 			case 0: /* constant zero */
-				value = 0;
+				curop->mode = opmode_Const;
+				curop->value = 0;
 				break;
 
 			case 1: /* one-byte constant */
 				/* Sign-extend from 8 bits to 32 */
-				value = (int)(signed char)(Mem1(pc));
+				curop->mode = opmode_Const;
+				curop->value = (int)(signed char)(Mem1(pc));
 				pc++;
 				break;
 
 			case 2: /* two-byte constant */
 				/* Sign-extend the first byte from 8 bits to 32; the subsequent
 				   byte must not be sign-extended. */
-				value = (int)(signed char)(Mem1(pc));
+				curop->mode = opmode_Const;
+				curop->value = (int)(signed char)(Mem1(pc));
 				pc++;
-				value = (value << 8) | (uint)(Mem1(pc));
+				curop->value = (curop->value << 8) | (uint)(Mem1(pc));
 				pc++;
 				break;
 
 			case 3: /* four-byte constant */
 				/* Bytes must not be sign-extended. */
-				value = Mem4(pc);
+				curop->mode = opmode_Const;
+				curop->value = Mem4(pc);
 				pc += 4;
 				break;
 
@@ -377,13 +388,8 @@ void Glulx::parse_operands(oparg_t *args, const operandlist_t *oplist) {
 
 MainMemAddr:
 				/* cases 5, 6, 7, 13, 14, 15 all wind up here. */
-				if (argsize == 4) {
-					value = Mem4(addr);
-				} else if (argsize == 2) {
-					value = Mem2(addr);
-				} else {
-					value = Mem1(addr);
-				}
+				curop->mode = opmode_Mem;
+				curop->value = addr;
 				break;
 
 			case 11: /* locals, four-byte address */
@@ -406,35 +412,29 @@ LocalsAddr:
 				   be four-byte aligned, but we don't check this explicitly.
 				   A "strict mode" interpreter probably should. It's also illegal
 				   for addr to be less than zero or greater than the size of
-				   the locals segment. */
-				addr += localsbase;
-				if (argsize == 4) {
-					value = Stk4(addr);
-				} else if (argsize == 2) {
-					value = Stk2(addr);
-				} else {
-					value = Stk1(addr);
-				}
+				   the locals segment. The locals segment moves between calls,
+				   so localsbase is only added when the value is loaded. */
+				curop->mode = opmode_Locals;
+				curop->value = addr;
 				break;
 
 			default:
-				value = 0;
+				curop->mode = opmode_Const;
+				curop->value = 0;
 				fatal_error("Unknown addressing mode in load operand.");
 			}
 
-			curarg->value = value;
-
 		} else { /* modeform_Store */
 			switch (mode) {
 
 			case 0: /* discard value */
-				curarg->desttype = 0;
-				curarg->value = 0;
+				curop->mode = 0;
+				curop->value = 0;
 				break;
 
 			case 8: /* push on stack */
-				curarg->desttype = 3;
-				curarg->value = 0;
+				curop->mode = 3;
+				curop->value = 0;
 				break;
 
 			case 15: /* main memory RAM, four-byte address */
@@ -472,8 +472,8 @@ LocalsAddr:
 
 WrMainMemAddr:
 				/* cases 5, 6, 7 all wind up here. */
-				curarg->desttype = 1;
-				curarg->value = addr;
+				curop->mode = 1;
+				curop->value = addr;
 				break;
 
 			case 11: /* locals, four-byte address */
@@ -497,26 +497,89 @@ WrLocalsAddr:
 				   A "strict mode" interpreter probably should. It's also illegal
 				   for addr to be less than zero or greater than the size of
 				   the locals segment. */
-				curarg->desttype = 2;
+				curop->mode = 2;
 				/* We don't add localsbase here; the store address for desttype 2
 				   is relative to the current locals segment, not an absolute
 				   stack position. */
-				curarg->value = addr;
+				curop->value = addr;
 				break;
 
 			case 1:
 			case 2:
 			case 3:
+				curop->mode = 0;
+				curop->value = 0;
 				fatal_error("Constant addressing mode in store operand.");
 				break;
 
 			default:
+				curop->mode = 0;
+				curop->value = 0;
 				fatal_error("Unknown addressing mode in store operand.");
 			}
 		}
 	}
 }
 
+void Glulx::load_operands(oparg_t *args, const decodedop_t *ops, const operandlist_t *oplist) {
+	int ix;
+	oparg_t *curarg;
+	const decodedop_t *curop;
+	int numops = oplist->num_ops;
+	int argsize = oplist->arg_size;
+
+	for (ix = 0, curarg = args, curop = ops; ix < numops; ix++, curarg++, curop++) {
+		uint value;
+
+		if (oplist->formlist[ix] != modeform_Load) {
+			/* Store operands were fully resolved when decoding */
+			curarg->desttype = curop->mode;
+			curarg->value = curop->value;
+			continue;
+		}
+
+		curarg->desttype = 0;
+
+		switch (curop->mode) {
+
+		case opmode_Const:
+			value = curop->value;
+			break;
+
+		case opmode_Stack:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			value = Stk4(stackptr);
+			break;
+
+		case opmode_Mem:
+			if (argsize == 4) {
+				value = Mem4(curop->value);
+			} else if (argsize == 2) {
+				value = Mem2(curop->value);
+			} else {
+				value = Mem1(curop->value);
+			}
+			break;
+
+		case opmode_Locals:
+		default:
+			if (argsize == 4) {
+				value = Stk4(curop->value + localsbase);
+			} else if (argsize == 2) {
+				value = Stk2(curop->value + localsbase);
+			} else {
+				value = Stk1(curop->value + localsbase);
+			}
+			break;
+		}
+
+		curarg->value = value;
+	}
+}
+
 void Glulx::store_operand(uint desttype, uint destaddr, uint storeval) {
 	switch (desttype) {
 
@@ -142,6 +142,10 @@ int osfmode( const char* fname, int follow_links, unsigned long* mode,
  */
 #define OS_DEFAULT_SWAP_ENABLED 0
 
+/* Likewise, load the whole game's objects up front and keep them in memory.
+ */
+#define OS_DEFAULT_CACHE_RESIDENT 1
+
 /* TADS 2 macro/function configuration.  Modern configurations always
  * use the no-macro versions, so these definitions should always be set
  * as shown below. */
@@ -199,6 +199,7 @@ mcmcx1def *mcmini(ulong max, uint pages, ulong swapsize,
     ctx->mcmcxpgmx = pages;          /* max number of pages we can allocate */
     ctx->mcmcxerr = errctx;
     ctx->mcmcxcsw = mcmcswf;
+    ctx->mcmcxres = FALSE;
     
     /* set up the free list with the remainder of the chunk */
     ctx->mcmcxfre = 1;     /* we've allocated object 0; obj 1 is free space */
@@ -842,7 +843,16 @@ void mcmuse(mcmcx1def *ctx, mcmon obj)
     MCMGLBCTX(ctx);
 
     if (ctx->mcmcxmru == obj) return;         /* already MRU; nothing to do */
-    
+
+    /*
+     *   When objects are kept resident, nothing gets swapped out or
+     *   discarded unless we actually run out of memory, so keeping the
+     *   chain in order isn't worth relinking the object on every unlock.
+     *   Objects still go into the chain once, so that they can be found
+     *   if we do have to make room after all.
+     */
+    if (ctx->mcmcxres && (o->mcmoflg & MCMOFLRU)) return;
+
     /* remove from LRU chain if it's in it */
     if (o->mcmoflg & MCMOFLRU) mcmunl(ctx, obj, &ctx->mcmcxlru);
 
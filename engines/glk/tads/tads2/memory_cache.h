@@ -108,6 +108,7 @@ struct mcmcx1def {
     mcmon      mcmcxunu;                             /* head of unused list */
     ushort     mcmcxpage;                      /* last page table slot used */
     ushort     mcmcxpgmx;        /* maximum number of pages we can allocate */
+    int        mcmcxres;     /* TRUE => objects are kept resident in memory */
     void     (*mcmcxcsw)(mcmcx1def *, mcmon, mcsseg, mcsseg);
                          /* change swap handle in object to new swap handle */
 };
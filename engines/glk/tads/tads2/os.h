@@ -347,6 +347,17 @@ osfildef *oserrop(const char *arg0);
 # define OS_DEFAULT_SWAP_ENABLED   1
 #endif
 
+/*
+ *   TADS 2 resident object cache.  Define OS_DEFAULT_CACHE_RESIDENT to 1
+ *   to load every object when the game starts and keep them all in
+ *   memory, as long as swapping is off and the cache size isn't limited.
+ *   Low-memory configurations should leave this at 0, so that objects are
+ *   paged in from the game file as needed.
+ */
+#ifndef OS_DEFAULT_CACHE_RESIDENT
+# define OS_DEFAULT_CACHE_RESIDENT 0
+#endif
+
 /*
  *   If the system "long description" (for the banner) isn't defined, make
  *   it the same as the platform ID string.  
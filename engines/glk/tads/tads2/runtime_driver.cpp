@@ -275,6 +275,7 @@ static void trdmain1(errcxdef *ec, int argc, char *argv[],
     const char *exefile;           /* try with executable file if no infile */
     ulong      swapsize = 0xffffffffL;        /* allow unlimited swap space */
     int        swapena = OS_DEFAULT_SWAP_ENABLED;      /* swapping enabled? */
+    int        resident = OS_DEFAULT_CACHE_RESIDENT;  /* keep objs resident? */
     int        i;
     int        pause = FALSE;                 /* pause after finishing game */
     fiolcxdef  fiolctx;
@@ -597,6 +598,17 @@ static void trdmain1(errcxdef *ec, int argc, char *argv[],
 
     /* initialize cache manager context */
     globalctx = mcmini(cachelimit, 128, swapsize, swapfp, swapname, ec);
+
+    /*
+     *   With no swap file and no limit on the cache size, objects never
+     *   need to leave memory, so load them all up front and keep them
+     *   resident rather than paging them in from the game file.
+     */
+    if (resident && swapfp == 0 && cachelimit == 0xffffffff)
+    {
+        globalctx->mcmcxres = TRUE;
+        preload = TRUE;
+    }
     mctx = mcmcini(globalctx, 128, fioldobj, &fiolctx,
                    objrevert, (void *)0);
     mctx->mcmcxrvc = mctx;
@@ -35,6 +35,11 @@ namespace Glk {
  */
 #define SLOP (2 * GLI_SUBPIX)
 
+/**
+ * Upper limit on the number of rows the scrollback can grow to
+ */
+#define MAXSCROLLBACK (SCROLLBACK * 4)
+
 
 TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : TextWindow(windows, rock),
 		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
@@ -149,7 +154,9 @@ void TextBufferWindow::reflow() {
 		return;
 	}
 
-	// copy text to temp buffers
+	// copy text to temp buffers. The text is always laid out again from the
+	// oldest retained line, since a line's breaks depend on the margin pictures
+	// and punctuation state left behind by the lines before it
 
 	oldattr = _attr;
 	curattr.clear();
@@ -241,7 +248,11 @@ void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
 
-	for (int i = 0; i < _scrollMax; i++)
+	// Only rows that are on screen, or will be once scrolled back to the
+	// bottom, need repainting. Rows further back get redrawn in full
+	// whenever they're scrolled into view
+	int last = MIN(_scrollMax, _scrollPos + _height);
+	for (int i = 0; i < last; i++)
 		_lines[i]._dirty = true;
 }
 
@@ -1087,8 +1098,9 @@ void TextBufferWindow::redraw() {
 	/*
 	 * draw the images
 	 */
-	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+	int lastRow = MIN(_scrollMax, _scrollBack - 1);
+	for (i = _scrollPos; i <= lastRow; i++) {
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1550,11 +1562,19 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// Recycle the oldest row of the scrollback as the new bottom row
+	TextBufferRow &oldest = _lines[_scrollBack - 1];
+	if (oldest._lPic)
+		oldest._lPic->decrement();
+	if (oldest._rPic)
+		oldest._rPic->decrement();
+
+	_lines.scroll();
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
+
+	for (int i = 1; i < _height && i < _scrollBack; i++)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1574,7 +1594,8 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._rPic = nullptr;
 	_lines[0]._lHyper = 0;
 	_lines[0]._rHyper = 0;
-	
+	_lines[0]._repaint = false;
+
 	Common::fill(_chars, _chars + TBLINELEN, ' ');
 	Attributes *a = _attrs;
 	for (int i = 0; i < TBLINELEN; ++i, ++a)
@@ -1589,7 +1610,13 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 void TextBufferWindow::scrollResize() {
 	int i;
 
-	_lines.clear();
+	if (_scrollBack >= MAXSCROLLBACK) {
+		// Scrollback is at its limit, so the oldest line gets dropped instead
+		_scrollMax = MIN(_scrollMax, _scrollBack - 1);
+		_lastSeen = MIN(_lastSeen, _scrollBack - 1);
+		return;
+	}
+
 	_lines.resize(_scrollBack + SCROLLBACK);
 
 	_chars = _lines[0]._chars;
@@ -1646,6 +1673,23 @@ void TextBufferWindow::flowBreak() {
 
 /*--------------------------------------------------------------------------*/
 
+void TextBufferWindow::TextBufferRows::resize(uint newSize) {
+	if (_first != 0) {
+		// Unwrap the rows so that row 0 is at the start of the array again
+		Common::Array<TextBufferRow> rows;
+		rows.reserve(newSize);
+		for (uint i = 0; i < _rows.size() && i < newSize; ++i)
+			rows.push_back((*this)[i]);
+
+		_rows = rows;
+		_first = 0;
+	}
+
+	_rows.resize(newSize);
+}
+
+/*--------------------------------------------------------------------------*/
+
 TextBufferWindow::TextBufferRow::TextBufferRow() : _len(0), _newLine(0), _dirty(false),
 	_repaint(false), _lPic(nullptr), _rPic(nullptr), _lHyper(0), _rHyper(0),
 	_lm(0), _rm(0) {
@@ -53,7 +53,43 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * Circular list of rows, with row 0 being the bottom (current) line.
+	 * Scrolling a line in rotates the list rather than moving every row
+	 * of the scrollback
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _first;
+	public:
+		/**
+		 * Constructor
+		 */
+		TextBufferRows() : _first(0) {}
+
+		TextBufferRow &operator[](int idx) {
+			return _rows[(_first + idx) % _rows.size()];
+		}
+		const TextBufferRow &operator[](int idx) const {
+			return _rows[(_first + idx) % _rows.size()];
+		}
+
+		uint size() const { return _rows.size(); }
+
+		/**
+		 * Changes the number of rows, keeping the existing rows in order
+		 */
+		void resize(uint newSize);
+
+		/**
+		 * Moves every row up by one, turning the topmost row into row 0
+		 */
+		void scroll() {
+			_first = (_first + _rows.size() - 1) % _rows.size();
+		}
+	};
 private:
 	PropFontInfo &_font;
 private:
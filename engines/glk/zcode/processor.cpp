@@ -198,6 +198,8 @@ void Processor::initialize() {
 		op0_opcodes[9] = &Processor::z_catch;
 		op1_opcodes[15] = &Processor::z_call_n;
 	}
+
+	clear_instruction_cache();
 }
 
 void Processor::load_operand(zbyte type) {
@@ -243,45 +245,138 @@ void Processor::load_all_operands(zbyte specifier) {
 	}
 }
 
+void Processor::decode_operand(DecodedInstruction &inst, zbyte type) {
+	zword value;
+
+	if (type & 2) {
+		// variable
+		zbyte variable;
+
+		CODE_BYTE(variable);
+		value = variable;
+	} else if (type & 1) {
+		// small constant
+		zbyte bvalue;
+
+		CODE_BYTE(bvalue);
+		value = bvalue;
+
+	} else {
+		// large constant
+		CODE_WORD(value);
+	}
+
+	inst._types[inst._argc] = type;
+	inst._values[inst._argc++] = value;
+}
+
+void Processor::decode_all_operands(DecodedInstruction &inst, zbyte specifier) {
+	for (int i = 6; i >= 0; i -= 2) {
+		zbyte type = (specifier >> i) & 0x03;
+
+		if (type == 3)
+			break;
+
+		decode_operand(inst, type);
+	}
+}
+
+void Processor::decode_instruction(DecodedInstruction &inst) {
+	zbyte opcode;
+	CODE_BYTE(opcode);
+	inst._opcode = opcode;
+	inst._argc = 0;
+
+	if (opcode < 0x80) {
+		// 2OP opcodes
+		decode_operand(inst, (zbyte)(opcode & 0x40) ? 2 : 1);
+		decode_operand(inst, (zbyte)(opcode & 0x20) ? 2 : 1);
+
+	} else if (opcode < 0xb0) {
+		// 1OP opcodes
+		decode_operand(inst, (zbyte)(opcode >> 4));
+
+	} else if (opcode >= 0xc0) {
+		// VAR opcodes
+		zbyte specifier1;
+		zbyte specifier2;
+
+		if (opcode == 0xec || opcode == 0xfa) {	// opcodes 0xec
+			CODE_BYTE(specifier1);			// and 0xfa are
+			CODE_BYTE(specifier2);          // call opcodes
+			decode_all_operands(inst, specifier1);	// with up to 8
+			decode_all_operands(inst, specifier2);	// arguments
+		} else {
+			CODE_BYTE(specifier1);
+			decode_all_operands(inst, specifier1);
+		}
+	}
+}
+
+void Processor::load_decoded_operands(const DecodedInstruction &inst) {
+	zargc = 0;
+
+	for (int i = 0; i < inst._argc; ++i) {
+		zword value = inst._values[i];
+
+		if (inst._types[i] & 2) {
+			// variable
+			if (value == 0)
+				value = *_sp++;
+			else if (value < 16)
+				value = *(_fp - value);
+			else {
+				zword addr = h_globals + 2 * (value - 16);
+				LOW_WORD(addr, value);
+			}
+		}
+
+		zargs[zargc++] = value;
+	}
+}
+
+void Processor::clear_instruction_cache() {
+	for (int i = 0; i < INSTRUCTION_CACHE_SIZE; ++i)
+		_instructionCache[i]._pc = INSTRUCTION_CACHE_EMPTY;
+}
+
 void Processor::interpret() {
 	do {
 		zbyte opcode;
-		CODE_BYTE(opcode);
-		zargc = 0;
+		uint32 pc;
+		GET_PC(pc);
+
+		// Static memory can't be written to, so instructions there only need decoding once
+		DecodedInstruction &inst = _instructionCache[pc & (INSTRUCTION_CACHE_SIZE - 1)];
+		if (inst._pc == pc) {
+			SET_PC(inst._nextPC);
+		} else {
+			inst._pc = INSTRUCTION_CACHE_EMPTY;
+			decode_instruction(inst);
+
+			if (pc >= h_dynamic_size) {
+				inst._pc = pc;
+				GET_PC(inst._nextPC);
+			}
+		}
+
+		opcode = inst._opcode;
+		load_decoded_operands(inst);
 
 		if (opcode < 0x80) {
 			// 2OP opcodes
-			load_operand((zbyte)(opcode & 0x40) ? 2 : 1);
-			load_operand((zbyte)(opcode & 0x20) ? 2 : 1);
-
 			(*this.*var_opcodes[opcode & 0x1f])();
 
 		} else if (opcode < 0xb0) {
 			// 1OP opcodes
-			load_operand((zbyte)(opcode >> 4));
-
 			(*this.*op1_opcodes[opcode & 0x0f])();
 
 		} else if (opcode < 0xc0) {
 			// 0OP opcodes
 			(*this.*op0_opcodes[opcode - 0xb0])();
 
-
 		} else {
 			// VAR opcodes
-			zbyte specifier1;
-			zbyte specifier2;
-
-			if (opcode == 0xec || opcode == 0xfa) {	// opcodes 0xec
-				CODE_BYTE(specifier1);			// and 0xfa are
-				CODE_BYTE(specifier2);          // call opcodes
-				load_all_operands(specifier1);	// with up to 8
-				load_all_operands(specifier2);	// arguments
-			} else {
-				CODE_BYTE(specifier1);
-				load_all_operands(specifier1);
-			}
-
 			(*this.*var_opcodes[opcode - 0xc0])();
 		}
 
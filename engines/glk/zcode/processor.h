@@ -47,6 +47,23 @@ class Processor;
 class Quetzal;
 typedef void (Processor::*Opcode)();
 
+/**
+ * An instruction whose opcode and operand types have already been read from the story file,
+ * as kept in the instruction cache. Operand values are either constants or variable numbers,
+ * so the variables still get read each time the instruction is executed
+ */
+struct DecodedInstruction {
+	uint32 _pc;				///< Address of the instruction, or INSTRUCTION_CACHE_EMPTY
+	uint32 _nextPC;			///< Address following the operands
+	zbyte _opcode;
+	zbyte _argc;
+	zbyte _types[8];		///< Operand types, as in the operand specifier
+	zword _values[8];		///< Constant value or variable number of each operand
+};
+
+#define INSTRUCTION_CACHE_SIZE 4096
+#define INSTRUCTION_CACHE_EMPTY 0xffffffff
+
 /**
  * Zcode processor
  */
@@ -62,6 +79,7 @@ private:
 	int _finished;
 	zword zargs[8];
 	int zargc;
+	DecodedInstruction _instructionCache[INSTRUCTION_CACHE_SIZE];
 	uint _randomInterval;
 	uint _randomCtr;
 	bool first_restart;
@@ -112,6 +130,34 @@ protected:
 	 */
 	void load_all_operands(zbyte specifier);
 
+	/**
+	 * Read the type and constant value or variable number of an operand, without fetching
+	 * the value of variables
+	 */
+	void decode_operand(DecodedInstruction &inst, zbyte type);
+
+	/**
+	 * Given the operand specifier byte, read all (up to four) operands for a VAR opcode
+	 * without fetching the value of variables
+	 */
+	void decode_all_operands(DecodedInstruction &inst, zbyte specifier);
+
+	/**
+	 * Read an instruction's opcode and operands starting at the current PC. Afterwards
+	 * the PC points to whatever follows the operands
+	 */
+	void decode_instruction(DecodedInstruction &inst);
+
+	/**
+	 * Load the operands of a decoded instruction into zargs
+	 */
+	void load_decoded_operands(const DecodedInstruction &inst);
+
+	/**
+	 * Empty the instruction cache
+	 */
+	void clear_instruction_cache();
+
 	/**
 	 * Call a subroutine. Save PC and FP then load new PC and initialise
 	 * new stack frame. Note that the caller may legally provide less or
@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "graphics/renderer.h"
 
@@ -27,6 +28,8 @@
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
 
+#include "engines/grim/lua/luadebug.h"
+
 namespace Grim {
 
 Debugger::Debugger() :
@@ -38,6 +41,8 @@ Debugger::Debugger() :
 	registerCmd("set_renderer", WRAP_METHOD(Debugger, cmd_set_renderer));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("lua_profile", WRAP_METHOD(Debugger, cmd_lua_profile));
+	registerCmd("lua_gc", WRAP_METHOD(Debugger, cmd_lua_gc));
 }
 
 Debugger::~Debugger() {
@@ -127,4 +132,60 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+struct LuaProfileTimeComparator {
+	bool operator()(const lua_ProfileEntry &a, const lua_ProfileEntry &b) const {
+		return a.msecs > b.msecs || (a.msecs == b.msecs && a.calls > b.calls);
+	}
+};
+
+bool Debugger::cmd_lua_profile(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("Usage: lua_profile <start|stop|reset|show [count]>\n");
+		debugPrintf("Lua profiling is %s\n", lua_isprofiling() ? "running" : "stopped");
+		return true;
+	}
+
+	if (!strcmp(argv[1], "start")) {
+		lua_setprofiling(true);
+		debugPrintf("Lua profiling started\n");
+	} else if (!strcmp(argv[1], "stop")) {
+		lua_setprofiling(false);
+		debugPrintf("Lua profiling stopped\n");
+	} else if (!strcmp(argv[1], "reset")) {
+		lua_resetprofile();
+	} else if (!strcmp(argv[1], "show")) {
+		uint count = (argc > 2) ? atoi(argv[2]) : 20;
+		Common::Array<lua_ProfileEntry> entries;
+		lua_getprofile(entries);
+		Common::sort(entries.begin(), entries.end(), LuaProfileTimeComparator());
+
+		debugPrintf("%8s %8s  %s\n", "ms", "calls", "function");
+		for (uint i = 0; i < entries.size() && i < count; ++i)
+			debugPrintf("%8u %8d  %s\n", entries[i].msecs, entries[i].calls, entries[i].name.c_str());
+	} else {
+		debugPrintf("Unknown option '%s'\n", argv[1]);
+	}
+	return true;
+}
+
+bool Debugger::cmd_lua_gc(int argc, const char **argv) {
+	if (argc > 1) {
+		if (!strcmp(argv[1], "full")) {
+			debugPrintf("Collected %d blocks\n", lua_collectgarbage(0));
+		} else if (!strcmp(argv[1], "reset")) {
+			lua_resetgcstats();
+		} else {
+			debugPrintf("Usage: lua_gc [full|reset]\n");
+			return true;
+		}
+	}
+
+	lua_GCStats stats;
+	lua_getgcstats(&stats);
+	debugPrintf("Cycle %s, %d blocks in use, threshold %d\n", stats.running ? "in progress" : "idle", stats.blocks, stats.threshold);
+	debugPrintf("%d cycles in %d steps, %u ms in total\n", stats.cycles, stats.steps, stats.totalTime);
+	debugPrintf("Last pause %u ms, longest pause %u ms, longest step %u ms\n", stats.lastPause, stats.maxPause, stats.maxStep);
+	return true;
+}
+
 }
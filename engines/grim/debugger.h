@@ -40,6 +40,8 @@ public:
 	bool cmd_set_renderer(int argc, const char **argv);
 	bool cmd_save(int argc, const char **argv);
 	bool cmd_load(int argc, const char **argv);
+	bool cmd_lua_profile(int argc, const char **argv);
+	bool cmd_lua_gc(int argc, const char **argv);
 };
 
 }
@@ -222,6 +222,8 @@ void EMIModel::setSkeleton(Skeleton *skel) {
 		return;
 	}
 	delete[] _vertexBoneInfo; _vertexBoneInfo = nullptr;
+	delete[] _skinMatrices;
+	_skinMatrices = new Math::Matrix4[skel->_numJoints];
 	_vertexBoneInfo = new int[_numBoneInfos];
 	for (int i = 0; i < _numBoneInfos; i++) {
 		_vertexBoneInfo[i] = _skeleton->findJointIndex(_boneNames[_boneInfos[i]._joint]);
@@ -232,6 +234,16 @@ void EMIModel::prepareForRender() {
 	if (!_skeleton || !_vertexBoneInfo)
 		return;
 
+	// Combine the inverse bind pose and the animated pose of every joint once,
+	// instead of applying both to every bone influence. The bind pose is a
+	// rigid transform, so its inverse is cheap to compute.
+	for (int i = 0; i < _skeleton->_numJoints; i++) {
+		const Joint &joint = _skeleton->_joints[i];
+		Math::Matrix4 inverseBindPose = joint._absMatrix;
+		inverseBindPose.invertAffineOrthonormal();
+		_skinMatrices[i] = joint._finalMatrix * inverseBindPose;
+	}
+
 	for (int i = 0; i < _numVertices; i++) {
 		_drawVertices[i].set(0.0f, 0.0f, 0.0f);
 		_drawNormals[i].set(0.0f, 0.0f, 0.0f);
@@ -243,20 +255,20 @@ void EMIModel::prepareForRender() {
 			boneVert++;
 		}
 
-		int jointIndex = _vertexBoneInfo[i];
-		const Math::Matrix4 &jointMatrix = _skeleton->_joints[jointIndex]._finalMatrix;
-		const Math::Matrix4 &bindPose = _skeleton->_joints[jointIndex]._absMatrix;
+		const float *m = _skinMatrices[_vertexBoneInfo[i]].getData();
+		const float weight = _boneInfos[i]._weight;
 
-		Math::Vector3d vert = _vertices[boneVert];
-		bindPose.inverseTranslate(&vert);
-		bindPose.inverseRotate(&vert);
-		jointMatrix.transform(&vert, true);
-		_drawVertices[boneVert] += vert * _boneInfos[i]._weight;
+		const Math::Vector3d &vert = _vertices[boneVert];
+		Math::Vector3d &drawVert = _drawVertices[boneVert];
+		drawVert.x() += (m[0] * vert.x() + m[1] * vert.y() + m[2] * vert.z() + m[3]) * weight;
+		drawVert.y() += (m[4] * vert.x() + m[5] * vert.y() + m[6] * vert.z() + m[7]) * weight;
+		drawVert.z() += (m[8] * vert.x() + m[9] * vert.y() + m[10] * vert.z() + m[11]) * weight;
 
-		Math::Vector3d normal = _normals[boneVert];
-		bindPose.inverseRotate(&normal);
-		jointMatrix.transform(&normal, false);
-		_drawNormals[boneVert] += normal * _boneInfos[i]._weight;
+		const Math::Vector3d &normal = _normals[boneVert];
+		Math::Vector3d &drawNormal = _drawNormals[boneVert];
+		drawNormal.x() += (m[0] * normal.x() + m[1] * normal.y() + m[2] * normal.z()) * weight;
+		drawNormal.y() += (m[4] * normal.x() + m[5] * normal.y() + m[6] * normal.z()) * weight;
+		drawNormal.z() += (m[8] * normal.x() + m[9] * normal.y() + m[10] * normal.z()) * weight;
 	}
 
 	for (int i = 0; i < _numVertices; i++) {
@@ -320,6 +332,7 @@ void EMIModel::updateLighting(const Math::Matrix4 &modelToWorld) {
 	// performance optimization, but NormDyn mode is visually superior in all cases.
 
 	Common::Array<Grim::Light *> activeLights;
+	Common::Array<Math::Vector3d> lightColors;
 	bool hasAmbient = false;
 
 	Actor *actor = _costume->getOwner();
@@ -327,6 +340,7 @@ void EMIModel::updateLighting(const Math::Matrix4 &modelToWorld) {
 	foreach(Light *l, g_grim->getCurrSet()->getLights(actor->isInOverworld())) {
 		if (l->_enabled) {
 			activeLights.push_back(l);
+			lightColors.push_back(Math::Vector3d(l->_color.getRed() / 255.0f, l->_color.getGreen() / 255.0f, l->_color.getBlue() / 255.0f));
 			if (l->_type == Light::Ambient)
 				hasAmbient = true;
 		}
@@ -381,12 +395,7 @@ void EMIModel::updateLighting(const Math::Matrix4 &modelToWorld) {
 				shade *= dot;
 			}
 
-			Math::Vector3d color;
-			color.x() = l->_color.getRed() / 255.0f;
-			color.y() = l->_color.getGreen() / 255.0f;
-			color.z() = l->_color.getBlue() / 255.0f;
-
-			result += color * shade;
+			result += lightColors[j] * shade;
 		}
 
 		if (!hasAmbient) {
@@ -444,6 +453,7 @@ EMIModel::EMIModel(const Common::String &filename, Common::SeekableReadStream *d
 	_boneInfos = nullptr;
 	_numBoneInfos = 0;
 	_vertexBoneInfo = nullptr;
+	_skinMatrices = nullptr;
 	_skeleton = nullptr;
 	_radius = 0;
 	_center = new Math::Vector3d();
@@ -474,6 +484,7 @@ EMIModel::~EMIModel() {
 	delete[] _mats;
 	delete[] _boneInfos;
 	delete[] _vertexBoneInfo;
+	delete[] _skinMatrices;
 	delete[] _boneNames;
 	delete[] _lighting;
 	delete[] _texFlags;
@@ -114,6 +114,7 @@ public:
 	BoneInfo *_boneInfos;
 	Common::String *_boneNames;
 	int *_vertexBoneInfo;
+	Math::Matrix4 *_skinMatrices;
 
 	// Stuff we dont know how to use:
 	float _radius;
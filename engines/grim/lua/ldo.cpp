@@ -21,6 +21,7 @@
 #include "engines/grim/lua/lopcodes.h"
 #include "engines/grim/lua/lparser.h"
 #include "engines/grim/lua/lstate.h"
+#include "engines/grim/lua/lstring.h"
 #include "engines/grim/lua/ltask.h"
 #include "engines/grim/lua/ltm.h"
 #include "engines/grim/lua/lua.h"
@@ -30,6 +31,8 @@
 #include "engines/grim/lua/lzio.h"
 
 #include "common/file.h"
+#include "common/hashmap.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 namespace Grim {
@@ -124,6 +127,120 @@ void luaD_callHook(StkId base, TProtoFunc *tf, int32 isreturn) {
 	lua_state->Cstack = oldCLS;
 }
 
+/*
+** Profiler: time spent running each function, not counting the functions it
+** calls. Lua functions are keyed by their prototype and C functions by their
+** address. Times come from getMillis, so a single run mostly measures zero
+** or one millisecond; summed over many runs the totals are still accurate.
+*/
+struct ProfileEntry {
+	ProfileEntry() : calls(0), msecs(0) {}
+
+	Common::String location;
+	int32 calls;
+	uint32 msecs;
+};
+
+typedef Common::HashMap<uintptr, ProfileEntry> ProfileMap;
+
+struct ProfileFrame {
+	uint32 start;
+	uint32 outerChildTime;
+};
+
+static ProfileMap *profileData = nullptr;
+static bool profiling = false;
+static uint32 profileChildTime = 0;
+
+static void profileEnter(ProfileFrame &frame) {
+	frame.start = g_system->getMillis();
+	frame.outerChildTime = profileChildTime;
+	profileChildTime = 0;
+}
+
+static void profileLeave(const ProfileFrame &frame, uintptr func, TProtoFunc *tf, bool newCall) {
+	uint32 elapsed = g_system->getMillis() - frame.start;
+	ProfileEntry &entry = (*profileData)[func];
+	if (entry.location.empty())
+		entry.location = tf ? Common::String::format("%s:%d", tf->fileName->str, (int)tf->lineDefined) : "(C)";
+	if (newCall)
+		entry.calls++;
+	entry.msecs += elapsed - MIN(elapsed, profileChildTime);
+	profileChildTime = frame.outerChildTime + elapsed;
+}
+
+/*
+** Run a Lua function until it returns or calls another function.
+*/
+static StkId execute(lua_Task *task) {
+	if (!profiling)
+		return luaV_execute(task);
+
+	ProfileFrame frame;
+	bool newCall = !task->some_flag;
+	profileEnter(frame);
+	StkId firstResult = luaV_execute(task);
+	profileLeave(frame, (uintptr)task->tf, task->tf, newCall);
+	return firstResult;
+}
+
+void lua_setprofiling(bool enable) {
+	if (enable && !profileData)
+		profileData = new ProfileMap();
+	profiling = enable;
+	profileChildTime = 0;
+}
+
+bool lua_isprofiling() {
+	return profiling;
+}
+
+void lua_resetprofile() {
+	if (profileData)
+		profileData->clear();
+}
+
+void lua_getprofile(Common::Array<lua_ProfileEntry> &entries) {
+	if (!profileData)
+		return;
+
+	// Name functions after the globals holding them
+	Common::HashMap<uintptr, const char *> globalNames;
+	for (int32 i = 0; i < NUM_HASHS; i++) {
+		stringtable *tb = &string_root[i];
+		for (int32 j = 0; j < tb->size; j++) {
+			TaggedString *ts = tb->hash[j];
+			if (!ts || ts == &EMPTY || ts->constindex == -1)
+				continue;
+			TObject *o = &ts->globalval;
+			if (ttype(o) == LUA_T_CLOSURE)
+				o = &clvalue(o)->consts[0];
+			if (ttype(o) == LUA_T_PROTO)
+				globalNames[(uintptr)tfvalue(o)] = ts->str;
+			else if (ttype(o) == LUA_T_CPROTO)
+				globalNames[(uintptr)fvalue(o)] = ts->str;
+		}
+	}
+
+	for (ProfileMap::const_iterator i = profileData->begin(); i != profileData->end(); ++i) {
+		lua_ProfileEntry entry;
+		const char *name;
+		if (globalNames.tryGetVal(i->_key, name))
+			entry.name = Common::String::format("%s (%s)", name, i->_value.location.c_str());
+		else
+			entry.name = i->_value.location;
+		entry.calls = i->_value.calls;
+		entry.msecs = i->_value.msecs;
+		entries.push_back(entry);
+	}
+}
+
+void luaD_freeprofile() {
+	delete profileData;
+	profileData = nullptr;
+	profiling = false;
+}
+
 /*
 ** Call a C function.
 ** Cstack.num is the number of arguments; Cstack.lua2C points to the
@@ -142,7 +259,14 @@ static StkId callC(lua_CFunction f, StkId base) {
 		(*lua_callhook)(Ref(r), "(C)", -1);
 	}
 	lua_state->state_counter2++;
-	(*f)();  // do the actual call
+	if (profiling) {
+		ProfileFrame frame;
+		profileEnter(frame);
+		(*f)();  // do the actual call
+		profileLeave(frame, (uintptr)f, nullptr, true);
+	} else {
+		(*f)();  // do the actual call
+	}
 	lua_state->state_counter2--;
 //	if (lua_callhook)  // func may have changed lua_callhook
 //		(*lua_callhook)(LUA_NOOBJECT, "(return)", 0);
@@ -197,7 +321,7 @@ int32 luaD_call(StkId base, int32 nResults) {
 				firstResult = callCclosure(c, fvalue(proto), base);
 			} else {
 				lua_taskresume(lua_state->task, c, tfvalue(proto), base);
-				firstResult = luaV_execute(lua_state->task);
+				firstResult = execute(lua_state->task);
 			}
 		} else if (ttype(funcObj) == LUA_T_PMARK) {
 			if (!lua_state->task->some_flag) {
@@ -207,7 +331,7 @@ int32 luaD_call(StkId base, int32 nResults) {
 				luaD_callTM(im, (lua_state->stack.top - lua_state->stack.stack) - (base - 1), nResults);
 				continue;
 			}
-			firstResult = luaV_execute(lua_state->task);
+			firstResult = execute(lua_state->task);
 		} else if (ttype(funcObj) == LUA_T_CMARK) {
 			if (!lua_state->task->some_flag) {
 				TObject *im = luaT_getimbyObj(funcObj, IM_FUNCTION);
@@ -227,11 +351,11 @@ int32 luaD_call(StkId base, int32 nResults) {
 				continue;
 			}
 			if (ttype(proto) != LUA_T_CPROTO)
-				firstResult = luaV_execute(lua_state->task);
+				firstResult = execute(lua_state->task);
 		} else if (ttype(funcObj) == LUA_T_PROTO) {
 			ttype(funcObj) = LUA_T_PMARK;
 			lua_taskresume(lua_state->task, nullptr, tfvalue(funcObj), base);
-			firstResult = luaV_execute(lua_state->task);
+			firstResult = execute(lua_state->task);
 		} else if (ttype(funcObj) == LUA_T_CPROTO) {
 			ttype(funcObj) = LUA_T_CMARK;
 			function = fvalue(funcObj);
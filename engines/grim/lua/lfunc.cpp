@@ -32,6 +32,7 @@ TProtoFunc *luaF_newproto() {
 	f->fileName = nullptr;
 	f->consts = nullptr;
 	f->nconsts = 0;
+	f->slotcache = nullptr;
 	f->locvars = nullptr;
 	luaO_insertlist(&rootproto, (GCnode *)f);
 	nblocks += gcsizeproto(f);
@@ -42,6 +43,7 @@ static void freefunc(TProtoFunc *f) {
 	luaM_free(f->code);
 	luaM_free(f->locvars);
 	luaM_free(f->consts);
+	luaM_free(f->slotcache);
 	luaM_free(f);
 }
 
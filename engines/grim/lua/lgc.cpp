@@ -16,6 +16,9 @@
 #include "engines/grim/lua/ltable.h"
 #include "engines/grim/lua/ltm.h"
 #include "engines/grim/lua/lua.h"
+#include "engines/grim/lua/luadebug.h"
+
+#include "common/system.h"
 
 namespace Grim {
 
@@ -150,45 +153,85 @@ static void strmark(TaggedString *s) {
 		s->head.marked = 1;
 }
 
-static void protomark(TProtoFunc *f) {
-	if (!f->head.marked) {
-		LocVar *v = f->locvars;
-		int32 i;
-		f->head.marked = 1;
-		if (f->fileName)
-			strmark(f->fileName);
-		for (i = 0; i < f->nconsts; i++)
-			markobject(&f->consts[i]);
-		if (v) {
-			for (; v->line != -1; v++) {
-				if (v->varname)
-					strmark(v->varname);
-			}
-		}
+/*
+** =======================================================
+** Incremental collection
+** =======================================================
+** A cycle marks the objects reachable from the roots a bounded amount at a
+** time, then finishes in one go: the roots are marked again, marking is
+** completed and everything left unmarked is freed.
+** Tables, closures and protos start white (marked 0), are queued on the
+** gray stack (marked 2) and turn black (marked 1) once traversed. A black
+** table that gets written to is turned gray again by luaC_barrier, so the
+** new value is not missed. Stacks, globals, locked references and tag
+** methods are marked again when the cycle finishes, so they need no
+** barrier. Closures and protos never change once created.
+*/
+
+#define GCSTEPSIZE		1024	// traversal work done per step
+#define GCSTEPBLOCKS	32		// blocks allocated between steps in a cycle
+
+enum GCPhase {
+	GCSpause,
+	GCSpropagate
+};
+
+static GCPhase gcphase = GCSpause;
+static TObject *graystack = nullptr;
+static int32 graysize = 0;
+static int32 graycount = 0;
+static lua_GCStats gcstats;
+
+static void pushgray(TObject *o) {
+	if (graycount >= graysize)
+		graysize = luaM_growvector(&graystack, graysize, TObject, memEM, MAX_INT);
+	graystack[graycount++] = *o;
+}
+
+static void graymark(GCnode *head, TObject *o) {
+	if (!head->marked) {
+		head->marked = 2;
+		pushgray(o);
 	}
 }
 
-static void closuremark(Closure *f) {
-	if (!f->head.marked) {
-		int32 i;
-		f->head.marked = 1;
-		for (i = f->nelems; i >= 0; i--)
-			markobject(&f->consts[i]);
+static int32 protomark(TProtoFunc *f) {
+	LocVar *v = f->locvars;
+	int32 i;
+	f->head.marked = 1;
+	if (f->fileName)
+		strmark(f->fileName);
+	for (i = 0; i < f->nconsts; i++)
+		markobject(&f->consts[i]);
+	if (v) {
+		for (; v->line != -1; v++) {
+			if (v->varname)
+				strmark(v->varname);
+			i++;
+		}
 	}
+	return i + 1;
 }
 
-static void hashmark(Hash *h) {
-	if (!h->head.marked) {
-		int32 i;
-		h->head.marked = 1;
-		for (i = 0; i < nhash(h); i++) {
-			Node *n = node(h, i);
-			if (ttype(ref(n)) != LUA_T_NIL) {
-				markobject(&n->ref);
-				markobject(&n->val);
-			}
+static int32 closuremark(Closure *f) {
+	int32 i;
+	f->head.marked = 1;
+	for (i = f->nelems; i >= 0; i--)
+		markobject(&f->consts[i]);
+	return f->nelems + 2;
+}
+
+static int32 hashmark(Hash *h) {
+	int32 i;
+	h->head.marked = 1;
+	for (i = 0; i < nhash(h); i++) {
+		Node *n = node(h, i);
+		if (ttype(ref(n)) != LUA_T_NIL) {
+			markobject(&n->ref);
+			markobject(&n->val);
 		}
 	}
+	return nhash(h) + 1;
 }
 
 static void globalmark() {
@@ -207,15 +250,15 @@ static int32 markobject(TObject *o) {
 		strmark(tsvalue(o));
 		break;
 	case LUA_T_ARRAY:
-		hashmark(avalue(o));
+		graymark(&avalue(o)->head, o);
 		break;
 	case LUA_T_CLOSURE:
 	case LUA_T_CLMARK:
-		closuremark(o->value.cl);
+		graymark(&o->value.cl->head, o);
 		break;
 	case LUA_T_PROTO:
 	case LUA_T_PMARK:
-		protomark(o->value.tf);
+		graymark(&o->value.tf->head, o);
 		break;
 	default:
 		break;  // numbers, cprotos, etc
@@ -223,20 +266,50 @@ static int32 markobject(TObject *o) {
 	return 0;
 }
 
-static void markall() {
+static void markroots() {
 	luaD_travstack(markobject); // mark stack objects
 	globalmark();  // mark global variable values and names
 	travlock(); // mark locked objects
 	luaT_travtagmethods(markobject);  // mark fallbacks
 }
 
-int32 lua_collectgarbage(int32 limit) {
+/*
+** Traverse gray objects until about 'work' object slots have been visited.
+** Returns true once there are no gray objects left.
+*/
+static bool propagate(int32 work) {
+	while (graycount > 0 && work > 0) {
+		TObject o = graystack[--graycount];
+		switch (ttype(&o)) {
+		case LUA_T_ARRAY:
+			work -= hashmark(avalue(&o));
+			break;
+		case LUA_T_CLOSURE:
+		case LUA_T_CLMARK:
+			work -= closuremark(o.value.cl);
+			break;
+		default:
+			work -= protomark(o.value.tf);
+			break;
+		}
+	}
+	return graycount == 0;
+}
+
+static void startcycle() {
+	gcphase = GCSpropagate;
+	markroots();
+}
+
+static int32 finishcycle(int32 limit) {
 	int32 recovered = nblocks;  // to subtract nblocks after gc
 	Hash *freetable;
 	TaggedString *freestr;
 	TProtoFunc *freefunc;
 	Closure *freeclos;
-	markall();
+	markroots();
+	propagate(MAX_INT);
+	gcphase = GCSpause;
 	invalidaterefs();
 	freestr = luaS_collector();
 	freetable = (Hash *)listcollect(&roottable);
@@ -252,12 +325,88 @@ int32 lua_collectgarbage(int32 limit) {
 	luaF_freeclosure(freeclos);
 	recovered = recovered - nblocks;
 	GCthreshold = (limit == 0) ? 2 * nblocks : nblocks + limit;
+	gcstats.cycles++;
+	return recovered;
+}
+
+/*
+** Do one bounded step of the current cycle, finishing it when marking is
+** done, and keep track of how long it took.
+*/
+static void step() {
+	uint32 start = g_system->getMillis();
+	if (propagate(GCSTEPSIZE)) {
+		finishcycle(0);
+		gcstats.lastPause = g_system->getMillis() - start;
+		gcstats.maxPause = MAX(gcstats.maxPause, gcstats.lastPause);
+		gcstats.totalTime += gcstats.lastPause;
+	} else {
+		uint32 elapsed = g_system->getMillis() - start;
+		gcstats.maxStep = MAX(gcstats.maxStep, elapsed);
+		gcstats.totalTime += elapsed;
+	}
+	gcstats.steps++;
+}
+
+void luaC_barrier(Hash *t) {
+	if (gcphase == GCSpropagate) {
+		TObject o;
+		ttype(&o) = LUA_T_ARRAY;
+		avalue(&o) = t;
+		t->head.marked = 2;
+		pushgray(&o);
+	}
+}
+
+void luaC_step() {
+	if (gcphase != GCSpause)
+		step();
+}
+
+void luaC_cancelcycle() {
+	luaM_free(graystack);
+	graystack = nullptr;
+	graysize = 0;
+	graycount = 0;
+	gcphase = GCSpause;
+}
+
+void lua_startgc() {
+	if (gcphase == GCSpause)
+		startcycle();
+}
+
+int32 lua_collectgarbage(int32 limit) {
+	uint32 start = g_system->getMillis();
+	if (gcphase == GCSpause)
+		startcycle();
+	int32 recovered = finishcycle(limit);
+	gcstats.lastPause = g_system->getMillis() - start;
+	gcstats.maxPause = MAX(gcstats.maxPause, gcstats.lastPause);
+	gcstats.totalTime += gcstats.lastPause;
 	return recovered;
 }
 
 void luaC_checkGC() {
-	if (nblocks >= GCthreshold)
-		lua_collectgarbage(0);
+	if (nblocks >= GCthreshold) {
+		if (gcphase == GCSpause)
+			startcycle();
+		step();
+		// Keep marking ahead of the scripts allocating during the cycle
+		if (gcphase == GCSpropagate)
+			GCthreshold = nblocks + GCSTEPBLOCKS;
+	}
+}
+
+void lua_getgcstats(lua_GCStats *stats) {
+	*stats = gcstats;
+	stats->running = gcphase != GCSpause;
+	stats->blocks = nblocks;
+	stats->threshold = GCthreshold;
+}
+
+void lua_resetgcstats() {
+	memset(&gcstats, 0, sizeof(gcstats));
 }
 
 } // end of namespace Grim
@@ -16,6 +16,9 @@ TObject* luaC_getref(int32 r);
 int32 luaC_ref(TObject *o, int32 lock);
 void luaC_hashcallIM(Hash *l);
 void luaC_strcallIM(TaggedString *l);
+void luaC_barrier(Hash *t);
+void luaC_step();
+void luaC_cancelcycle();
 
 } // end of namespace Grim
 
@@ -94,6 +94,7 @@ typedef struct TProtoFunc {
 	GCnode head;
 	struct TObject *consts;
 	int32 nconsts;
+	int32 *slotcache;  // table slot where each constant key was last found
 	byte *code;  // ends with opcode ENDCODE
 	int32 lineDefined;
 	TaggedString  *fileName;
@@ -312,6 +312,7 @@ void lua_Restore(SaveGame *savedState) {
 		} else {
 			tempProtoFunc->consts = nullptr;
 		}
+		tempProtoFunc->slotcache = nullptr;
 
 		for (l = 0; l < tempProtoFunc->nconsts; l++) {
 			restoreObjectValue(&tempProtoFunc->consts[l], savedState);
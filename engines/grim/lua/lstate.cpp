@@ -224,6 +224,8 @@ void lua_close() {
 	luaM_free(IMtable);
 	luaM_free(refArray);
 	luaM_free(Mbuffer);
+	luaD_freeprofile();
+	luaC_cancelcycle();
 
 	LState *tmpState, *state;
 	for (state = lua_rootState; state != nullptr;) {
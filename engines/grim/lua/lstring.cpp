@@ -30,14 +30,19 @@ void luaS_init() {
 	}
 }
 
-static uint32 hash(const char *s, int32 tag) {
+/*
+** Long strings are hashed on a sample of at most 32 characters, so that
+** interning a line of dialog does not walk it byte by byte.
+*/
+static uint32 hash(const char *s, int32 tag, uint32 l) {
 	uint32 h;
 	if (tag != LUA_T_STRING) {
 		h = (uintptr)s;
 	} else {
-		h = 0;
-		while (*s)
-			h = ((h << 5) - h) ^ (byte)*(s++);
+		uint32 step = (l >> 5) + 1;
+		h = l;
+		for (; l >= step; l -= step)
+			h = h ^ ((h << 5) + (h >> 2) + (byte)s[l - 1]);
 	}
 	return h;
 }
@@ -65,12 +70,11 @@ static void grow(stringtable *tb) {
 	tb->hash = newhash;
 }
 
-static TaggedString *newone(const char *buff, int32 tag, uint32 h) {
+static TaggedString *newone(const char *buff, int32 tag, uint32 h, uint32 l) {
 	TaggedString *ts;
 	if (tag == LUA_T_STRING) {
-		int l = strlen(buff);
 		ts = (TaggedString *)luaM_malloc(sizeof(TaggedString) + l);
-		strcpy(ts->str, buff);
+		memcpy(ts->str, buff, l + 1);
 		ts->globalval.ttype = LUA_T_NIL;  /* initialize global value */
 		ts->constindex = 0;
 		nblocks += gcsizestring(l);
@@ -89,7 +93,8 @@ static TaggedString *newone(const char *buff, int32 tag, uint32 h) {
 
 static TaggedString *insert(const char *buff, int32 tag, stringtable *tb) {
 	TaggedString *ts;
-	uint32 h = hash(buff, tag);
+	uint32 l = (tag == LUA_T_STRING) ? strlen(buff) : 0;
+	uint32 h = hash(buff, tag, l);
 	int32 size = tb->size;
 	int32 i;
 	int32 j = -1;
@@ -101,7 +106,7 @@ static TaggedString *insert(const char *buff, int32 tag, stringtable *tb) {
 		if (ts == &EMPTY)
 			j = i;
 		else if ((ts->constindex >= 0) ? // is a string?
-				(tag == LUA_T_STRING && (strcmp(buff, ts->str) == 0)) :
+				(tag == LUA_T_STRING && ts->hash == h && (strcmp(buff, ts->str) == 0)) :
 				((tag == ts->globalval.ttype || tag == LUA_ANYTAG) && buff == (const char *)ts->globalval.value.ts))
 			return ts;
 		if (++i == size)
@@ -112,7 +117,7 @@ static TaggedString *insert(const char *buff, int32 tag, stringtable *tb) {
 		i = j;
 	else
 		tb->nuse++;
-	ts = tb->hash[i] = newone(buff, tag, h);
+	ts = tb->hash[i] = newone(buff, tag, h, l);
 	return ts;
 }
 
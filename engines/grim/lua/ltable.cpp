@@ -7,6 +7,7 @@
 #define FORBIDDEN_SYMBOL_EXCEPTION_longjmp
 
 #include "engines/grim/lua/lauxlib.h"
+#include "engines/grim/lua/lgc.h"
 #include "engines/grim/lua/lmem.h"
 #include "engines/grim/lua/lobject.h"
 #include "engines/grim/lua/lstate.h"
@@ -163,6 +164,8 @@ TObject *luaH_get(Hash *t, TObject *r) {
 ** node for the given reference and also return its pointer.
 */
 TObject *luaH_set(Hash *t, TObject *r) {
+	if (t->head.marked == 1)
+		luaC_barrier(t);  // already traversed by the collector
 	Node *n = node(t, present(t, r));
 	if (ttype(ref(n)) == LUA_T_NIL) {
 		nuse(t)++;
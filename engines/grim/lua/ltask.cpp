@@ -10,6 +10,7 @@
 #include "engines/grim/lua/lauxlib.h"
 #include "engines/grim/lua/lmem.h"
 #include "engines/grim/lua/ldo.h"
+#include "engines/grim/lua/lgc.h"
 #include "engines/grim/lua/lvm.h"
 #include "engines/grim/grim.h"
 
@@ -319,7 +320,14 @@ void sleep_for() {
 }
 
 void lua_runtasks() {
-	if (!lua_state || !lua_state->next) {
+	if (!lua_state) {
+		return;
+	}
+
+	// Spread any collection cycle in progress over the frames
+	luaC_step();
+
+	if (!lua_state->next) {
 		return;
 	}
 
@@ -10,6 +10,9 @@
 
 #include "engines/grim/lua/lua.h"
 
+#include "common/array.h"
+#include "common/str.h"
+
 namespace Grim {
 
 typedef lua_Object lua_Function;
@@ -17,6 +20,24 @@ typedef lua_Object lua_Function;
 typedef void (*lua_LHFunction)(int32 line);
 typedef void (*lua_CHFunction)(lua_Function func, const char *file, int32 line);
 
+struct lua_ProfileEntry {
+	Common::String name;
+	int32 calls;
+	uint32 msecs;  // in milliseconds, excluding called functions
+};
+
+struct lua_GCStats {
+	bool running;  // a collection cycle is in progress
+	int32 blocks;
+	int32 threshold;
+	int32 cycles;
+	int32 steps;
+	uint32 lastPause;  // milliseconds taken by the step finishing the last cycle
+	uint32 maxPause;
+	uint32 maxStep;  // longest step not finishing a cycle
+	uint32 totalTime;
+};
+
 lua_Function lua_stackedfunction(int32 level);
 void lua_funcinfo(lua_Object func, const char **filename, int32 *linedefined);
 int32 lua_currentline(lua_Function func);
@@ -25,6 +46,14 @@ const char *lua_getobjname(lua_Object o, const char **name);
 lua_Object lua_getlocal(lua_Function func, int32 local_number, char **name);
 int32 lua_setlocal(lua_Function func, int32 local_number);
 
+void lua_setprofiling(bool enable);
+bool lua_isprofiling();
+void lua_resetprofile();
+void lua_getprofile(Common::Array<lua_ProfileEntry> &entries);
+
+void lua_getgcstats(lua_GCStats *stats);
+void lua_resetgcstats();
+
 extern lua_LHFunction lua_linehook;
 extern lua_CHFunction lua_callhook;
 extern int32 lua_debug;
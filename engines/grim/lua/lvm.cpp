@@ -113,6 +113,44 @@ void luaV_gettable() {
 		lua_error("indexed expression not a table");
 }
 
+/*
+** Index the table at top-1 with constant 'index' of the running function,
+** as done by GETDOTTED and PUSHSELF.
+** Strings are interned and a key has a single slot in a table, so a slot
+** holding the key is a hit whatever table it belongs to. Each constant
+** remembers the slot it was last found in, which stays valid across all
+** tables of the same size filled the same way. Anything else goes through
+** luaV_gettable.
+*/
+static void getdotted(lua_Task *task, int32 index) {
+	Stack *S = task->S;
+	TObject *t = S->top - 1;
+	TObject *key = &task->consts[index];
+	*S->top++ = *key;
+	if (ttype(t) == LUA_T_ARRAY && ttype(key) == LUA_T_STRING &&
+			ttype(luaT_getim(avalue(t)->htag, IM_GETTABLE)) == LUA_T_NIL) {
+		TProtoFunc *tf = task->tf;
+		Hash *h = avalue(t);
+		if (!tf->slotcache) {
+			tf->slotcache = luaM_newvector(tf->nconsts, int32);
+			memset(tf->slotcache, 0, tf->nconsts * sizeof(int32));
+		}
+		int32 slot = tf->slotcache[index];
+		if (slot >= nhash(h) || ttype(ref(node(h, slot))) != LUA_T_STRING ||
+				tsvalue(ref(node(h, slot))) != tsvalue(key)) {
+			slot = present(h, key);
+			tf->slotcache[index] = slot;
+		}
+		Node *n = node(h, slot);
+		if (ttype(ref(n)) != LUA_T_NIL && ttype(val(n)) != LUA_T_NIL) {
+			--S->top;
+			*(S->top - 1) = *val(n);
+			return;
+		}
+	}
+	luaV_gettable();
+}
+
 /*
 ** Function to store indexed based on values at the stack.top
 ** mode = 0: raw store (without tag methods)
@@ -331,8 +369,7 @@ getglobal:
 		case GETDOTTED7:
 			task->aux -= GETDOTTED0;
 getdotted:
-			*task->S->top++ = task->consts[task->aux];
-			luaV_gettable();
+			getdotted(task, task->aux);
 			break;
 		case PUSHSELFW:
 			task->aux = next_word(task->pc);
@@ -352,8 +389,7 @@ getdotted:
 pushself:
 			{
 				TObject receiver = *(task->S->top - 1);
-				*task->S->top++ = task->consts[task->aux];
-				luaV_gettable();
+				getdotted(task, task->aux);
 				*task->S->top++ = receiver;
 				break;
 			}
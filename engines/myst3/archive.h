@@ -88,6 +88,7 @@ public:
 	void close();
 
 	const Common::String &getRoomName() const { return _roomName; }
+	const char *getFileName() const { return _file.getName(); }
 	uint32 getDirectorySize() const { return _directorySize; }
 
 private:
@@ -126,6 +127,8 @@ public:
 
 	Common::SeekableReadStream *getData() const;
 	uint16 getFace() const { return _subentry->face; }
+	uint32 getOffset() const { return _subentry->offset; }
+	const Archive *getArchive() const { return _archive; }
 	Archive::ResourceType getType() const { return _subentry->type; }
 	SpotItemData getSpotItemData() const;
 	VideoData getVideoData() const;
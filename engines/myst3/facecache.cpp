@@ -0,0 +1,138 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/myst3/facecache.h"
+#include "engines/myst3/myst3.h"
+
+#include "common/debug.h"
+
+#include "graphics/surface.h"
+
+namespace Myst3 {
+
+FaceCache::FaceCache(uint32 budget) :
+		_budget(budget),
+		_size(0),
+		_useCounter(0) {
+}
+
+FaceCache::~FaceCache() {
+	clear();
+}
+
+Common::String FaceCache::getKey(const ResourceDescription &jpegDesc) {
+	// Multi-room archives have no room name, so key on the archive file
+	return Common::String::format("%s-%d", jpegDesc.getArchive()->getFileName(), jpegDesc.getOffset());
+}
+
+uint32 FaceCache::getSurfaceSize(const Graphics::Surface *surface) {
+	return surface->pitch * surface->h;
+}
+
+Graphics::Surface *FaceCache::getFace(const ResourceDescription &jpegDesc) {
+	Common::String key = getKey(jpegDesc);
+
+	Entry *entry;
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end()) {
+		entry = &it->_value;
+	} else {
+		entry = insert(key, Myst3Engine::decodeJpeg(&jpegDesc));
+	}
+
+	entry->lastUse = ++_useCounter;
+
+	// Faces get drawn on by spot items, hand out a copy
+	Graphics::Surface *surface = new Graphics::Surface();
+	surface->copyFrom(*entry->surface);
+	return surface;
+}
+
+void FaceCache::queuePrefetch(const ResourceDescription &jpegDesc) {
+	if (_entries.contains(getKey(jpegDesc)))
+		return;
+
+	_prefetchQueue.push_back(jpegDesc);
+}
+
+void FaceCache::clearPrefetchQueue() {
+	_prefetchQueue.clear();
+}
+
+bool FaceCache::prefetchNext() {
+	while (!_prefetchQueue.empty()) {
+		ResourceDescription jpegDesc = _prefetchQueue.front();
+		_prefetchQueue.pop_front();
+
+		Common::String key = getKey(jpegDesc);
+		if (_entries.contains(key))
+			continue;
+
+		debugC(kDebugNode, "Prefetching cube face %s", key.c_str());
+
+		Entry *entry = insert(key, Myst3Engine::decodeJpeg(&jpegDesc));
+		entry->lastUse = ++_useCounter;
+		return true;
+	}
+
+	return false;
+}
+
+void FaceCache::clear() {
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); it++) {
+		it->_value.surface->free();
+		delete it->_value.surface;
+	}
+
+	_entries.clear();
+	_prefetchQueue.clear();
+	_size = 0;
+}
+
+FaceCache::Entry *FaceCache::insert(const Common::String &key, Graphics::Surface *surface) {
+	uint32 surfaceSize = getSurfaceSize(surface);
+	evict(surfaceSize);
+
+	Entry &entry = _entries[key];
+	entry.surface = surface;
+	entry.lastUse = 0;
+	_size += surfaceSize;
+
+	return &entry;
+}
+
+void FaceCache::evict(uint32 neededSize) {
+	while (!_entries.empty() && _size + neededSize > _budget) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); it++) {
+			if (it->_value.lastUse < oldest->_value.lastUse)
+				oldest = it;
+		}
+
+		_size -= getSurfaceSize(oldest->_value.surface);
+		oldest->_value.surface->free();
+		delete oldest->_value.surface;
+		_entries.erase(oldest);
+	}
+}
+
+} // End of namespace Myst3
@@ -0,0 +1,103 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef MYST3_FACECACHE_H
+#define MYST3_FACECACHE_H
+
+#include "engines/myst3/archive.h"
+
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/str.h"
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Myst3 {
+
+/**
+ * Keeps decoded cube faces in memory so that going back and forth between
+ * nodes does not require decoding the same JPEG images over and over.
+ *
+ * Faces of the nodes reachable from the current node are decoded ahead of
+ * time, one face per frame, so that moving to them does not stall.
+ * The decoded surfaces are evicted in least recently used order once
+ * their total size exceeds the memory budget.
+ */
+class FaceCache {
+public:
+	FaceCache(uint32 budget);
+	~FaceCache();
+
+	/**
+	 * Get a decoded copy of a cube face, decoding it if it is not cached.
+	 *
+	 * The returned surface is owned by the caller.
+	 */
+	Graphics::Surface *getFace(const ResourceDescription &jpegDesc);
+
+	/** Queue a cube face for decoding during idle time */
+	void queuePrefetch(const ResourceDescription &jpegDesc);
+
+	/**
+	 * Forget the queued faces.
+	 *
+	 * Must be called before the archive the queued faces come from is closed.
+	 */
+	void clearPrefetchQueue();
+
+	/**
+	 * Decode the next queued face.
+	 *
+	 * @return false if there was nothing left to decode
+	 */
+	bool prefetchNext();
+
+	/** Drop all the cached faces */
+	void clear();
+
+private:
+	struct Entry {
+		Graphics::Surface *surface;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<Common::String, Entry> EntryMap;
+
+	static Common::String getKey(const ResourceDescription &jpegDesc);
+	static uint32 getSurfaceSize(const Graphics::Surface *surface);
+
+	Entry *insert(const Common::String &key, Graphics::Surface *surface);
+	void evict(uint32 neededSize);
+
+	EntryMap _entries;
+	Common::List<ResourceDescription> _prefetchQueue;
+
+	uint32 _budget;
+	uint32 _size;
+	uint32 _useCounter;
+};
+
+} // End of namespace Myst3
+
+#endif // MYST3_FACECACHE_H
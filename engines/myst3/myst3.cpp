@@ -38,6 +38,7 @@
 #include "engines/myst3/console.h"
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/myst3.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/nodeframe.h"
@@ -62,12 +63,15 @@
 
 namespace Myst3 {
 
+// Memory used for decoded cube faces, about five nodes worth of faces
+static const uint32 kFaceCacheBudget = 48 * 1024 * 1024;
+
 Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		Engine(syst), _system(syst), _gameDescription(version),
 		_db(0), _scriptEngine(0),
 		_state(0), _node(0), _scene(0), _archiveNode(0),
 		_cursor(0), _inventory(0), _gfx(0), _menu(0),
-		_rnd(0), _sound(0), _ambient(0),
+		_rnd(0), _sound(0), _ambient(0), _faceCache(0),
 		_inputSpacePressed(false), _inputEnterPressed(false),
 		_inputEscapePressed(false), _inputTildePressed(false),
 		_inputEscapePressedNotConsumed(false),
@@ -126,6 +130,7 @@ Myst3Engine::~Myst3Engine() {
 	delete _rnd;
 	delete _sound;
 	delete _ambient;
+	delete _faceCache;
 	delete _frameLimiter;
 	delete _gfx;
 }
@@ -169,6 +174,7 @@ Common::Error Myst3Engine::run() {
 		_menu = new PagingMenu(this);
 	}
 	_archiveNode = new Archive();
+	_faceCache = new FaceCache(kFaceCacheBudget);
 
 	_system->showMouse(false);
 
@@ -217,6 +223,7 @@ Common::Error Myst3Engine::run() {
 
 	unloadNode();
 
+	_faceCache->clearPrefetchQueue();
 	_archiveNode->close();
 	_gfx->freeFont();
 
@@ -755,6 +762,11 @@ void Myst3Engine::drawFrame(bool noSwap) {
 	_gfx->flipBuffer();
 
 	if (!noSwap) {
+		// Use the remaining frame time to decode the faces of the nodes
+		// the player is likely to go to next
+		if (_interactive)
+			_faceCache->prefetchNext();
+
 		_frameLimiter->delayBeforeSwap();
 		_system->updateScreen();
 		_state->updateFrameCounters();
@@ -830,6 +842,9 @@ void Myst3Engine::goToNode(uint16 nodeID, TransitionType transitionType) {
 void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 	unloadNode();
 
+	// The queued faces may belong to the node archive that is about to be closed
+	_faceCache->clearPrefetchQueue();
+
 	_scriptEngine->run(&_db->getNodeInitScript());
 
 	if (nodeID)
@@ -868,6 +883,8 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 	_shakeEffect = ShakeEffect::create(this);
 	_rotationEffect = RotationEffect::create(this);
 
+	prefetchNeighbourNodes();
+
 	// WORKAROUND: In Narayan, the scripts in node NACH 9 test on var 39
 	// without first reinitializing it leading to Saavedro not always giving
 	// Releeshan to the player when he is trapped between both shields.
@@ -875,6 +892,45 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 		_state->setVar(39, 0);
 }
 
+void Myst3Engine::prefetchNeighbourNodes() {
+	if (_state->getViewType() != kCube)
+		return;
+
+	uint16 currentNode = _state->getLocationNode();
+	NodePtr nodeData = _db->getNodeData(currentNode, _state->getLocationRoom(), _state->getLocationAge());
+	if (!nodeData)
+		return;
+
+	for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+		const Common::Array<Opcode> &script = nodeData->hotspots[i].script;
+
+		for (uint j = 0; j < script.size(); j++) {
+			const Opcode &opcode = script[j];
+
+			// Only consider the opcodes moving to a node of the current room
+			// with the node id stored as a literal
+			switch (opcode.op) {
+			case 136: // goToNodeTransition
+			case 137: // goToNodeTrans2
+			case 138: // goToNodeTrans1
+			case 140: // zipToNode
+				break;
+			default:
+				continue;
+			}
+
+			if (opcode.args.empty() || opcode.args[0] <= 0 || opcode.args[0] == currentNode)
+				continue;
+
+			for (uint face = 1; face <= 6; face++) {
+				ResourceDescription jpegDesc = getFileDescription("", opcode.args[0], face, Archive::kCubeFace);
+				if (jpegDesc.isValid())
+					_faceCache->queuePrefetch(jpegDesc);
+			}
+		}
+	}
+}
+
 void Myst3Engine::unloadNode() {
 	if (!_node)
 		return;
@@ -80,6 +80,7 @@ class ShakeEffect;
 class RotationEffect;
 class Transition;
 class FrameLimiter;
+class FaceCache;
 struct NodeData;
 struct Myst3GameDescription;
 
@@ -103,6 +104,7 @@ public:
 	Database *_db;
 	Sound *_sound;
 	Ambient *_ambient;
+	FaceCache *_faceCache;
 	
 	Common::RandomSource *_rnd;
 
@@ -237,6 +239,9 @@ private:
 	HotSpot *getHoveredHotspot(NodePtr nodeData, uint16 var = 0);
 	void updateCursor();
 
+	/** Queue the cube faces of the nodes reachable from the current node for prefetching */
+	void prefetchNeighbourNodes();
+
 	bool checkDatafiles();
 
 	bool addArchive(const Common::String &file, bool mandatory);
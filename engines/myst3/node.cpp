@@ -22,6 +22,7 @@
 
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/node.h"
 #include "engines/myst3/myst3.h"
 #include "engines/myst3/state.h"
@@ -34,7 +35,7 @@
 namespace Myst3 {
 
 void Face::setTextureFromJPEG(const ResourceDescription *jpegDesc) {
-	_bitmap = Myst3Engine::decodeJpeg(jpegDesc);
+	_bitmap = _vm->_faceCache->getFace(*jpegDesc);
 	_texture = _vm->_gfx->createTexture(_bitmap);
 
 	// Set the whole texture as dirty
@@ -0,0 +1,80 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/savewriter.h"
+
+#include "common/savefile.h"
+#include "common/textconsole.h"
+
+BackgroundSaveWriter::BackgroundSaveWriter() : _lastSlice(0) {
+}
+
+BackgroundSaveWriter::~BackgroundSaveWriter() {
+	flush();
+}
+
+void BackgroundSaveWriter::queue(Common::OutSaveFile *saveFile, byte *data, uint32 size) {
+	PendingSave save;
+	save.saveFile = saveFile;
+	save.data = data;
+	save.size = size;
+	save.written = 0;
+
+	_pending.push_back(save);
+}
+
+void BackgroundSaveWriter::update(uint32 millis) {
+	if (_pending.empty() || millis - _lastSlice < kSliceInterval)
+		return;
+
+	writeSlice(kSliceSize);
+	_lastSlice = millis;
+}
+
+void BackgroundSaveWriter::flush() {
+	while (!_pending.empty())
+		writeSlice(0xFFFFFFFF);
+}
+
+void BackgroundSaveWriter::writeSlice(uint32 budget) {
+	while (budget > 0 && !_pending.empty()) {
+		PendingSave &save = _pending.front();
+
+		uint32 len = MIN(budget, save.size - save.written);
+		if (len > 0) {
+			save.saveFile->write(save.data + save.written, len);
+			save.written += len;
+			budget -= len;
+		}
+
+		if (save.written < save.size)
+			break;
+
+		save.saveFile->finalize();
+		if (save.saveFile->err())
+			warning("BackgroundSaveWriter: Writing a savegame failed");
+
+		delete save.saveFile;
+		free(save.data);
+		_pending.pop_front();
+	}
+}
@@ -0,0 +1,110 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef ENGINES_SAVEWRITER_H
+#define ENGINES_SAVEWRITER_H
+
+#include "common/list.h"
+
+namespace Common {
+class OutSaveFile;
+}
+
+/**
+ * @defgroup engines_savewriter Background save writer
+ * @ingroup engines
+ *
+ * @brief Writes serialized save states to disk a slice at a time.
+ *
+ * @{
+ */
+
+/**
+ * Writes savegame snapshots to their save files in the background of the
+ * engine loop.
+ *
+ * The engine serializes the game state into memory and queues the buffer
+ * together with the save file it should end up in. The buffer is then
+ * written, and thereby compressed, in small slices from update(), which is
+ * called while polling events. The save file is finalized and closed once
+ * all of its data has been written.
+ */
+class BackgroundSaveWriter {
+public:
+	BackgroundSaveWriter();
+	/** Write out all pending saves before destroying the writer. */
+	~BackgroundSaveWriter();
+
+	/**
+	 * Queue a save for writing.
+	 *
+	 * Takes ownership of both @p saveFile and @p data. The latter must
+	 * have been allocated using malloc().
+	 */
+	void queue(Common::OutSaveFile *saveFile, byte *data, uint32 size);
+
+	/**
+	 * Write the next slice of the queued saves, unless one has already
+	 * been written in the last kSliceInterval milliseconds.
+	 *
+	 * @param millis  The current time, as returned by OSystem::getMillis().
+	 */
+	void update(uint32 millis);
+
+	/**
+	 * Block until all queued saves have been written and finalized.
+	 */
+	void flush();
+
+	/**
+	 * Return true if some queued saves have not been finalized yet.
+	 */
+	bool hasPendingSaves() const { return !_pending.empty(); }
+
+private:
+	enum {
+		/** Number of bytes written per slice. */
+		kSliceSize = 64 * 1024,
+		/** Minimum time between two slices, in milliseconds. */
+		kSliceInterval = 10
+	};
+
+	struct PendingSave {
+		Common::OutSaveFile *saveFile;
+		byte *data;
+		uint32 size;
+		uint32 written;
+	};
+
+	/**
+	 * Write at most @p budget bytes of the queued saves, finalizing every
+	 * save which got completely written.
+	 */
+	void writeSlice(uint32 budget);
+
+	uint32 _lastSlice;
+	Common::List<PendingSave> _pending;
+};
+
+/** @} */
+
+#endif
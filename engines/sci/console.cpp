@@ -54,6 +54,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "sci/graphics/celobj32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/paint32.h"
 #include "sci/graphics/palette32.h"
@@ -150,6 +151,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
+	registerCmd("cel_cache",          WRAP_METHOD(Console, cmdCelCache));
 	// Segments
 	registerCmd("segment_table",		WRAP_METHOD(Console, cmdPrintSegmentTable));
 	registerCmd("segtable",			WRAP_METHOD(Console, cmdPrintSegmentTable));	// alias
@@ -377,6 +379,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
+	debugPrintf(" cel_cache - Shows usage statistics of the cel cache (SCI2+)\n");
 	debugPrintf("\n");
 	debugPrintf("Segments:\n");
 	debugPrintf(" segment_table / segtable - Lists all segments\n");
@@ -2314,6 +2317,19 @@ bool Console::cmdShowSavedBits(int argc, const char **argv) {
 }
 
 
+bool Console::cmdCelCache(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		CelObj::printCacheStats(this);
+	} else {
+		debugPrintf("This SCI version does not use a cel cache\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdParseGrammar(int argc, const char **argv) {
 	debugPrintf("Parse grammar, in strict GNF:\n");
 
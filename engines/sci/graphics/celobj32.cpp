@@ -20,6 +20,7 @@
  *
  */
 
+#include "sci/console.h"
 #include "sci/resource/resource.h"
 #include "sci/engine/features.h"
 #include "sci/engine/seg_manager.h"
@@ -35,6 +36,14 @@
 #include "common/config-manager.h"
 #include "common/gui_options.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace Sci {
 #pragma mark CelScaler
 
@@ -89,9 +98,10 @@ bool CelObj::_drawBlackLines = false;
 void CelObj::init() {
 	CelObj::deinit();
 	_drawBlackLines = false;
-	_nextCacheId = 1;
 	_scaler.reset(new CelScaler());
-	_cache.reset(new CelCache(100));
+	// SSCI uses a 100-entry cache. High-resolution games construct far more
+	// cels than that per room, and cache entries are small, so keep more.
+	_cache.reset(new CelCache(1000));
 }
 
 void CelObj::deinit() {
@@ -147,6 +157,24 @@ struct SCALER_NoScale {
 			return *_row++;
 		}
 	}
+
+	/**
+	 * Reads `width` pixels starting at the current target position. Unflipped
+	 * rows are returned in place; flipped rows are reversed into `buffer`.
+	 */
+	inline const byte *readRow(byte *buffer, const int16 width) {
+		if (FLIP) {
+			for (int16 x = 0; x < width; ++x) {
+				buffer[x] = read();
+			}
+			return buffer;
+		}
+
+		assert(_row + width <= _rowEdge);
+		const byte *row = _row;
+		_row += width;
+		return row;
+	}
 };
 
 template<bool FLIP, typename READER>
@@ -303,6 +331,20 @@ struct SCALER_Scale {
 		assert(_x >= _minX && _x <= _maxX);
 		return _row[_valuesX[_x++]];
 	}
+
+	/**
+	 * Gathers `width` scaled pixels starting at the current target position
+	 * into `buffer`.
+	 */
+	inline const byte *readRow(byte *buffer, const int16 width) {
+		assert(_x >= _minX && _x + width - 1 <= _maxX);
+		const int16 *valuesX = _valuesX + _x;
+		for (int16 x = 0; x < width; ++x) {
+			buffer[x] = _row[valuesX[x]];
+		}
+		_x += width;
+		return buffer;
+	}
 };
 
 template<bool FLIP, typename READER>
@@ -457,6 +499,76 @@ inline byte translateMacColor(bool isMacSource, byte color) {
 	return color;
 }
 
+/**
+ * Copies a row of cel pixels to the target. If SKIP is set, pixels matching
+ * `skipColor` leave the target untouched; if LIMIT is set, so do pixels at or
+ * above `startColor`. Mac colors are translated in the same pass.
+ */
+template<bool SKIP, bool LIMIT>
+static inline void copyRow(byte *target, const byte *source, const int16 width, const uint8 skipColor, const uint8 startColor, const bool isMacSource) {
+	if (LIMIT && startColor == 0) {
+		return;
+	}
+
+	int16 x = 0;
+
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i ones = _mm_set1_epi8(-1);
+	const __m128i skip = _mm_set1_epi8((char)skipColor);
+	const __m128i maxColor = _mm_set1_epi8((char)(startColor - 1));
+	for (; x + 16 <= width; x += 16) {
+		__m128i pixels = _mm_loadu_si128((const __m128i *)(source + x));
+		__m128i keep = zero;
+		if (SKIP) {
+			keep = _mm_cmpeq_epi8(pixels, skip);
+		}
+		if (LIMIT) {
+			const __m128i inRange = _mm_cmpeq_epi8(_mm_min_epu8(pixels, maxColor), pixels);
+			keep = _mm_or_si128(keep, _mm_xor_si128(inRange, ones));
+		}
+		if (isMacSource) {
+			// 0 and 255 swap, which is the same as inverting them
+			pixels = _mm_xor_si128(pixels, _mm_or_si128(_mm_cmpeq_epi8(pixels, zero), _mm_cmpeq_epi8(pixels, ones)));
+		}
+		if (SKIP || LIMIT) {
+			const __m128i current = _mm_loadu_si128((const __m128i *)(target + x));
+			pixels = _mm_or_si128(_mm_and_si128(keep, current), _mm_andnot_si128(keep, pixels));
+		}
+		_mm_storeu_si128((__m128i *)(target + x), pixels);
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	const uint8x16_t zero = vdupq_n_u8(0);
+	const uint8x16_t ones = vdupq_n_u8(255);
+	const uint8x16_t skip = vdupq_n_u8(skipColor);
+	const uint8x16_t limit = vdupq_n_u8(startColor);
+	for (; x + 16 <= width; x += 16) {
+		uint8x16_t pixels = vld1q_u8(source + x);
+		uint8x16_t keep = zero;
+		if (SKIP) {
+			keep = vceqq_u8(pixels, skip);
+		}
+		if (LIMIT) {
+			keep = vorrq_u8(keep, vcgeq_u8(pixels, limit));
+		}
+		if (isMacSource) {
+			pixels = veorq_u8(pixels, vorrq_u8(vceqq_u8(pixels, zero), vceqq_u8(pixels, ones)));
+		}
+		if (SKIP || LIMIT) {
+			pixels = vbslq_u8(keep, vld1q_u8(target + x), pixels);
+		}
+		vst1q_u8(target + x, pixels);
+	}
+#endif
+
+	for (; x < width; ++x) {
+		const byte pixel = source[x];
+		if ((!SKIP || pixel != skipColor) && (!LIMIT || pixel < startColor)) {
+			target[x] = translateMacColor(isMacSource, pixel);
+		}
+	}
+}
+
 /**
  * Pixel mapper for a CelObj with transparent pixels and no
  * remapping data.
@@ -467,6 +579,10 @@ struct MAPPER_NoMD {
 			*target = translateMacColor(isMacSource, pixel);
 		}
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		copyRow<true, false>(target, source, width, skipColor, 0, isMacSource);
+	}
 };
 
 /**
@@ -477,6 +593,14 @@ struct MAPPER_NoMDNoSkip {
 	inline void draw(byte *target, const byte pixel, const uint8, const bool isMacSource) const {
 		*target = translateMacColor(isMacSource, pixel);
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		if (isMacSource) {
+			copyRow<false, false>(target, source, width, skipColor, 0, isMacSource);
+		} else {
+			memcpy(target, source, width);
+		}
+	}
 };
 
 /**
@@ -495,6 +619,14 @@ struct MAPPER_Map {
 			}
 		}
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		// Remapping reads back from the target pixel, so each pixel is
+		// resolved individually
+		for (int16 x = 0; x < width; ++x) {
+			draw(target + x, source[x], skipColor, isMacSource);
+		}
+	}
 };
 
 /**
@@ -509,6 +641,10 @@ struct MAPPER_NoMap {
 			*target = translateMacColor(isMacSource, pixel);
 		}
 	}
+
+	inline void drawRow(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		copyRow<true, true>(target, source, width, skipColor, g_sci->_gfxRemap32->getStartColor(), isMacSource);
+	}
 };
 
 void CelObj::draw(Buffer &target, const ScreenItem &screenItem, const Common::Rect &targetRect) const {
@@ -612,6 +748,13 @@ void CelObj::draw(Buffer &target, const Common::Rect &targetRect, const Common::
 	drawTo(target, targetRect, scaledPosition, square, square);
 }
 
+bool CelObj::coversTarget(const ScreenItem &screenItem) const {
+	// Only the uncompressed, unscaled opaque path draws without checking the
+	// skip color
+	return !_remap && !_transparent && _compressionType == kCelCompressionNone &&
+		screenItem._ratioX.isOne() && screenItem._ratioY.isOne();
+}
+
 void CelObj::drawTo(Buffer &target, Common::Rect const &targetRect, Common::Point const &scaledPosition, Ratio const &scaleX, Ratio const &scaleY) const {
 	if (_remap) {
 		if (scaleX.isOne() && scaleY.isOne()) {
@@ -685,45 +828,120 @@ void CelObj::submitPalette() const {
 #pragma mark -
 #pragma mark CelObj - Caching
 
-int CelObj::_nextCacheId = 1;
-Common::ScopedPtr<CelCache> CelObj::_cache;
+CelCache::CelCache(const uint maxSize) :
+	_mostRecent(nullptr),
+	_leastRecent(nullptr),
+	_maxSize(maxSize),
+	_hits(0),
+	_misses(0) {}
+
+CelCache::~CelCache() {
+	clear();
+}
 
-int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
-	*nextInsertIndex = -1;
-	int oldestId = _nextCacheId + 1;
-	int oldestIndex = 0;
+const CelObj *CelCache::find(const CelInfo32 &celInfo) {
+	EntryMap::const_iterator it = _entries.find(celInfo);
+	if (it == _entries.end()) {
+		++_misses;
+		return nullptr;
+	}
 
-	for (int i = 0, len = _cache->size(); i < len; ++i) {
-		CelCacheEntry &entry = (*_cache)[i];
+	++_hits;
+	Entry *entry = it->_value;
+	if (entry != _mostRecent) {
+		detach(entry);
+		attachFront(entry);
+	}
+	return entry->celObj;
+}
 
-		if (entry.celObj == nullptr) {
-			if (*nextInsertIndex == -1) {
-				*nextInsertIndex = i;
-			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
-		} else if (oldestId > entry.id) {
-			oldestId = entry.id;
-			oldestIndex = i;
-		}
+void CelCache::insert(const CelInfo32 &celInfo, CelObj *celObj) {
+	EntryMap::iterator it = _entries.find(celInfo);
+	if (it != _entries.end()) {
+		Entry *entry = it->_value;
+		delete entry->celObj;
+		entry->celObj = celObj;
+		detach(entry);
+		attachFront(entry);
+		return;
+	}
+
+	Entry *entry;
+	if (_entries.size() >= _maxSize && _leastRecent) {
+		// Reuse the least recently used entry for the new cel
+		entry = _leastRecent;
+		detach(entry);
+		_entries.erase(entry->celInfo);
+		delete entry->celObj;
+	} else {
+		entry = new Entry();
+	}
+
+	entry->celInfo = celInfo;
+	entry->celObj = celObj;
+	attachFront(entry);
+	_entries[celInfo] = entry;
+}
+
+void CelCache::clear() {
+	Entry *entry = _mostRecent;
+	while (entry) {
+		Entry *next = entry->next;
+		delete entry->celObj;
+		delete entry;
+		entry = next;
+	}
+
+	_entries.clear();
+	_mostRecent = _leastRecent = nullptr;
+}
+
+void CelCache::detach(Entry *entry) {
+	if (entry->prev) {
+		entry->prev->next = entry->next;
+	} else {
+		_mostRecent = entry->next;
+	}
+
+	if (entry->next) {
+		entry->next->prev = entry->prev;
+	} else {
+		_leastRecent = entry->prev;
 	}
+}
 
-	if (*nextInsertIndex == -1) {
-		*nextInsertIndex = oldestIndex;
+void CelCache::attachFront(Entry *entry) {
+	entry->prev = nullptr;
+	entry->next = _mostRecent;
+	if (_mostRecent) {
+		_mostRecent->prev = entry;
+	} else {
+		_leastRecent = entry;
 	}
+	_mostRecent = entry;
+}
+
+Common::ScopedPtr<CelCache> CelObj::_cache;
+
+const CelObj *CelObj::searchCache(const CelInfo32 &celInfo) const {
+	return _cache->find(celInfo);
+}
 
-	return -1;
+void CelObj::putCopyInCache() const {
+	_cache->insert(_info, duplicate());
 }
 
-void CelObj::putCopyInCache(const int cacheIndex) const {
-	if (cacheIndex == -1) {
-		error("Invalid cache index");
+void CelObj::printCacheStats(Console *con) {
+	if (!_cache) {
+		con->debugPrintf("The cel cache is not initialised\n");
+		return;
 	}
 
-	CelCacheEntry &entry = (*_cache)[cacheIndex];
-	entry.celObj.reset(duplicate());
-	entry.id = ++_nextCacheId;
+	const uint32 hits = _cache->getHits();
+	const uint32 lookups = hits + _cache->getMisses();
+	con->debugPrintf("Cel cache: %u of %u entries used\n", _cache->size(), _cache->getMaxSize());
+	con->debugPrintf("%u hits, %u misses (%u%% hit rate)\n", hits, _cache->getMisses(),
+					 lookups ? (uint)((uint64)hits * 100 / lookups) : 0);
 }
 
 #pragma mark -
@@ -748,6 +966,8 @@ struct RENDERER {
 		const int16 skipStride = target.w - targetRect.width();
 		const int16 targetWidth = targetRect.width();
 		const int16 targetHeight = targetRect.height();
+		assert(targetWidth <= kCelScalerTableSize);
+		byte rowBuffer[kCelScalerTableSize];
 		for (int16 y = 0; y < targetHeight; ++y) {
 			if (DRAW_BLACK_LINES && (y % 2) == 0) {
 				memset(targetPixel, 0, targetWidth);
@@ -757,11 +977,9 @@ struct RENDERER {
 
 			_scaler.setTarget(targetRect.left, targetRect.top + y);
 
-			for (int16 x = 0; x < targetWidth; ++x) {
-				_mapper.draw(targetPixel++, _scaler.read(), _skipColor, _isMacSource);
-			}
+			_mapper.drawRow(targetPixel, _scaler.readRow(rowBuffer, targetWidth), targetWidth, _skipColor, _isMacSource);
 
-			targetPixel += skipStride;
+			targetPixel += targetWidth + skipStride;
 		}
 	}
 };
@@ -970,16 +1188,13 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 	_compressionType = kCelCompressionInvalid;
 	_transparent = true;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjView *const cachedCelObj = dynamic_cast<CelObjView *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjView *const cachedCelObj = dynamic_cast<const CelObjView *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjView in cache slot %d", cacheIndex);
+			error("Expected a CelObjView in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1077,7 +1292,7 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 		_remap = analyzeForRemap();
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjView::analyzeUncompressedForRemap() const {
@@ -1178,16 +1393,13 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 	_transparent = true;
 	_remap = false;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjPic *const cachedCelObj = dynamic_cast<CelObjPic *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjPic *const cachedCelObj = dynamic_cast<const CelObjPic *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjPic in cache slot %d", cacheIndex);
+			error("Expected a CelObjPic in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1251,7 +1463,7 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 		}
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjPic::analyzeUncompressedForSkip() const {
@@ -23,6 +23,7 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource/resource.h"
@@ -30,6 +31,7 @@
 #include "sci/util.h"
 
 namespace Sci {
+class Console;
 typedef Common::Rational Ratio;
 
 // SCI32 has four different coordinate systems:
@@ -105,7 +107,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +117,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -138,18 +140,83 @@ struct CelInfo32 {
 	}
 };
 
+struct CelInfo32Hash {
+	uint operator()(const CelInfo32 &info) const {
+		return (info.type << 28) ^ (info.resourceId << 12) ^ (info.loopNo << 8) ^ info.celNo ^
+			(info.bitmap.getSegment() << 16) ^ info.bitmap.getOffset();
+	}
+};
+
+struct CelInfo32EqualTo {
+	bool operator()(const CelInfo32 &a, const CelInfo32 &b) const {
+		return a == b;
+	}
+};
+
 class CelObj;
-struct CelCacheEntry {
+
+/**
+ * A least recently used cache of cel objects, indexed by the CelInfo32 of each
+ * cel.
+ */
+class CelCache {
+public:
+	CelCache(const uint maxSize);
+	~CelCache();
+
 	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
+	 * Returns the cached cel object matching the given CelInfo32 and marks it
+	 * as the most recently used, or returns null if there is none.
 	 */
-	int id;
-	Common::ScopedPtr<CelObj> celObj;
-	CelCacheEntry() : id(0) {}
-};
+	const CelObj *find(const CelInfo32 &celInfo);
+
+	/**
+	 * Adds a cel object to the cache, taking ownership of it. When the cache is
+	 * full, the least recently used cel object is discarded to make room.
+	 */
+	void insert(const CelInfo32 &celInfo, CelObj *celObj);
+
+	/**
+	 * Discards all cached cel objects.
+	 */
+	void clear();
+
+	uint size() const { return _entries.size(); }
+	uint getMaxSize() const { return _maxSize; }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+
+private:
+	struct Entry {
+		CelInfo32 celInfo;
+		CelObj *celObj;
+		Entry *prev;
+		Entry *next;
+	};
 
-typedef Common::Array<CelCacheEntry> CelCache;
+	typedef Common::HashMap<CelInfo32, Entry *, CelInfo32Hash, CelInfo32EqualTo> EntryMap;
+
+	/**
+	 * The cached cel objects.
+	 */
+	EntryMap _entries;
+
+	/**
+	 * The ends of the list of entries in order of use, most recently used
+	 * first.
+	 */
+	Entry *_mostRecent, *_leastRecent;
+
+	/**
+	 * The maximum number of cel objects in the cache.
+	 */
+	uint _maxSize;
+
+	uint32 _hits, _misses;
+
+	void detach(Entry *entry);
+	void attachFront(Entry *entry);
+};
 
 #pragma mark -
 #pragma mark CelScaler
@@ -351,6 +418,11 @@ public:
 	 */
 	static void deinit();
 
+	/**
+	 * Prints the usage statistics of the cel cache to the debugger console.
+	 */
+	static void printCacheStats(Console *con);
+
 	virtual ~CelObj() {};
 
 	/**
@@ -389,6 +461,12 @@ public:
 	 */
 	void drawTo(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition, const Ratio &scaleX, const Ratio &scaleY) const;
 
+	/**
+	 * Returns true if drawing this cel for the given screen item writes every
+	 * pixel of its target rect, hiding anything drawn there before it.
+	 */
+	virtual bool coversTarget(const ScreenItem &screenItem) const;
+
 	/**
 	 * Creates a copy of this cel on the free store and returns a pointer to the
 	 * new object. The new cel will point to a shared copy of bitmap/resource
@@ -453,12 +531,6 @@ private:
 #pragma mark -
 #pragma mark CelObj - Caching
 protected:
-	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
-	 */
-	static int _nextCacheId;
-
 	/**
 	 * A cache of cel objects used to avoid reinitialisation overhead for cels
 	 * with the same CelInfo32.
@@ -467,16 +539,15 @@ protected:
 
 	/**
 	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
-	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
-	 * the oldest item in the cache, which can be used to replace the oldest
-	 * item with a newer item.
+	 * not found, null is returned.
 	 */
-	int searchCache(const CelInfo32 &celInfo, int *nextInsertIndex) const;
+	const CelObj *searchCache(const CelInfo32 &celInfo) const;
 
 	/**
-	 * Puts a copy of this CelObj into the cache at the given cache index.
+	 * Puts a copy of this CelObj into the cache, replacing the least recently
+	 * used item if the cache is full.
 	 */
-	void putCopyInCache(int index) const;
+	void putCopyInCache() const;
 };
 
 #pragma mark -
@@ -599,6 +670,7 @@ public:
 	void draw(Buffer &target, const Common::Rect &targetRect) const;
 	void draw(Buffer &target, const ScreenItem &screenItem, const Common::Rect &targetRect, const bool mirrorX) override;
 	void draw(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition, const bool mirrorX) override;
+	bool coversTarget(const ScreenItem &) const override { return true; }
 
 	CelObjColor *duplicate() const override;
 	const SciSpan<const byte> getResPointer() const override;
@@ -1001,9 +1001,33 @@ void GfxFrameout::drawEraseList(const RectList &eraseList, const Plane &plane) {
 
 void GfxFrameout::drawScreenItemList(const DrawList &screenItemList) {
 	const DrawList::size_type drawListSize = screenItemList.size();
+
+	// Items are drawn in priority order, so an item that lies entirely inside
+	// an opaque item drawn later would be completely overwritten; such items
+	// still contribute to the show list but are not rendered
+	Common::Array<bool> hidden(drawListSize, false);
+	Common::Array<Common::Rect> coveringRects;
+	for (DrawList::size_type i = drawListSize; i-- > 0; ) {
+		const DrawItem &drawItem = *screenItemList[i];
+		for (uint j = 0; j < coveringRects.size(); ++j) {
+			if (coveringRects[j].contains(drawItem.rect)) {
+				hidden[i] = true;
+				break;
+			}
+		}
+
+		const ScreenItem &screenItem = *drawItem.screenItem;
+		if (!hidden[i] && screenItem._celObj->coversTarget(screenItem)) {
+			coveringRects.push_back(drawItem.rect);
+		}
+	}
+
 	for (DrawList::size_type i = 0; i < drawListSize; ++i) {
 		const DrawItem &drawItem = *screenItemList[i];
 		mergeToShowList(drawItem.rect, _showList, _overdrawThreshold);
+		if (hidden[i]) {
+			continue;
+		}
 		const ScreenItem &screenItem = *drawItem.screenItem;
 		CelObj &celObj = *screenItem._celObj;
 		celObj.draw(_currentBuffer, screenItem, drawItem.rect, screenItem._mirrorX ^ celObj._mirrorX);
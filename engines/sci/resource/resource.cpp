@@ -22,6 +22,7 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
@@ -427,6 +428,51 @@ void ResourceManager::loadResource(Resource *res) {
 	if (_patcher) {
 		_patcher->applyPatch(*res);
 	};
+
+	if (res->getType() == kResourceTypeScript && !_detectionMode) {
+		queueRoomPrefetch(res->getNumber());
+	}
+}
+
+void ResourceManager::queueRoomPrefetch(uint16 scriptNumber) {
+	// Rooms conventionally draw the pic with the same number as their script,
+	// so scripts without such a pic are not treated as rooms
+	if (!testResource(ResourceId(kResourceTypePic, scriptNumber))) {
+		return;
+	}
+
+	static const ResourceType roomResourceTypes[] = {
+		kResourceTypePic,
+		kResourceTypePalette,
+		kResourceTypeView,
+		kResourceTypeMessage
+	};
+
+	// Anything still queued belongs to a room that has already been left
+	_prefetchQueue.clear();
+
+	for (int i = 0; i < ARRAYSIZE(roomResourceTypes); ++i) {
+		const ResourceId id(roomResourceTypes[i], scriptNumber);
+		if (testResource(id)) {
+			_prefetchQueue.push_back(id);
+		}
+	}
+}
+
+bool ResourceManager::prefetchNextResource() {
+	while (!_prefetchQueue.empty()) {
+		const ResourceId id = _prefetchQueue.front();
+		_prefetchQueue.pop_front();
+
+		const Resource *res = testResource(id);
+		if (res && res->_status == kResStatusNoMalloc) {
+			debugC(2, kDebugLevelResMan, "[resMan] Prefetching %s", id.toString().c_str());
+			findResource(id, false);
+			return true;
+		}
+	}
+
+	return false;
 }
 
 
@@ -989,11 +1035,12 @@ ResourceManager::ResourceManager(const bool detectionMode) :
 	_detectionMode(detectionMode) {}
 
 void ResourceManager::init() {
-	_maxMemoryLRU = 256 * 1024; // 256KiB
+	_maxMemoryLRU = 1024 * 1024; // 1MiB
 	_memoryLocked = 0;
 	_memoryLRU = 0;
 	_LRU.clear();
 	_resMap.clear();
+	_prefetchQueue.clear();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
 	_currentDiscNo = 1;
@@ -1063,7 +1110,16 @@ void ResourceManager::init() {
 	// cache, leading to constant decompression of picture resources
 	// and making the renderer very slow.
 	if (getSciVersion() >= SCI_VERSION_2) {
-		_maxMemoryLRU = 4096 * 1024; // 4MiB
+		_maxMemoryLRU = 16384 * 1024; // 16MiB
+	}
+
+	// Allow ports with little memory, or users with lots of it, to choose
+	// their own cache size (in KiB)
+	if (!_detectionMode && ConfMan.hasKey("resource_cache_size")) {
+		const int cacheSize = ConfMan.getInt("resource_cache_size");
+		if (cacheSize > 0) {
+			_maxMemoryLRU = cacheSize * 1024;
+		}
 	}
 
 	switch (_viewType) {
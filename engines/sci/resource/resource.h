@@ -396,6 +396,13 @@ public:
 	 */
 	bool hasResourceType(ResourceType type);
 
+	/**
+	 * Loads the next resource queued for prefetching into the resource cache,
+	 * if there is one. This is meant to be called while the engine is idle.
+	 * @return true if a resource was loaded, false if there was nothing to do
+	 */
+	bool prefetchNextResource();
+
 	void setAudioLanguage(int language);
 	int getAudioLanguage() const;
 	void changeAudioDirectory(Common::String path);
@@ -497,6 +504,18 @@ protected:
 	ResVersion _mapVersion; ///< resource.map version
 	bool _isSci2Mac;
 
+	/**
+	 * Resources which are likely to be needed soon, to be loaded into the
+	 * resource cache by prefetchNextResource.
+	 */
+	Common::List<ResourceId> _prefetchQueue;
+
+	/**
+	 * Queues the resources belonging to a room for prefetching, if the given
+	 * script is the script of a room.
+	 */
+	void queueRoomPrefetch(uint16 scriptNumber);
+
 	/**
 	 * Add a path to the resource manager's list of sources.
 	 * @return a pointer to the added source structure, or NULL if an error occurred.
@@ -916,7 +916,10 @@ void SciEngine::sleep(uint32 msecs) {
 #endif
 		time = g_system->getMillis();
 		if (time + 10 < wakeUpTime) {
-			g_system->delayMillis(10);
+			// Use the spare time to load resources for the current room
+			if (!_resMan->prefetchNextResource()) {
+				g_system->delayMillis(10);
+			}
 		} else {
 			if (time < wakeUpTime)
 				g_system->delayMillis(wakeUpTime - time);
@@ -69,7 +69,8 @@ RenderObject::RenderObject(RenderObjectPtr<RenderObject> parentPtr, TYPES type,
 	_refreshForced(true),
 	_handle(0),
 	_version(++_nextGlobalVersion),
-	_isSolid(false) {
+	_isSolid(false),
+	_inStaticLayer(false) {
 
 	if (handle == 0)
 		_handle = RenderObjectRegistry::instance().registerObject(this);
@@ -143,7 +144,7 @@ bool RenderObject::render(RectangleList *updateRects, const Common::Array<int> &
 	for (RectangleList::iterator rectIt = updateRects->begin(); !needRender && rectIt != updateRects->end(); ++rectIt, ++index)
 		needRender = (_bbox.contains(*rectIt) || _bbox.intersects(*rectIt)) && getAbsoluteZ() >= updateRectsMinZ[index];
 
-	if (needRender)
+	if (needRender && !_inStaticLayer)
 		doRender(updateRects);
 
 	// Draw all children
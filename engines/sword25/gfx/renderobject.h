@@ -372,6 +372,17 @@ public:
 		return _isSolid;
 	}
 
+	// Draws only this object, without its children. Used by the
+	// RenderObjectManager to composite the static layer.
+	bool renderSelf(RectangleList *updateRects) {
+		return doRender(updateRects);
+	}
+
+	// Objects taken from the static layer are skipped by render()
+	void setInStaticLayer(bool inStaticLayer) {
+		_inStaticLayer = inStaticLayer;
+	}
+
 	// Persistenz-Methoden
 	// -------------------
 	virtual bool persist(OutputPersistenceBlock &writer);
@@ -416,6 +427,9 @@ protected:
 	// This should be set to true if the RenderObject is NOT alpha-blended to optimize drawing
 	bool _isSolid;
 
+	// Set by the RenderObjectManager while the object is drawn from its static layer
+	bool _inStaticLayer;
+
 	/// Ein Pointer auf den BS_RenderObjektManager, der das Objekt verwaltet.
 	RenderObjectManager *_managerPtr;
 
@@ -62,7 +62,7 @@ RenderObjectManager::RenderObjectManager(int width, int height, int framebufferC
 	_frameStarted(false) {
 	// Wurzel des BS_RenderObject-Baumes erzeugen.
 	_rootPtr = (new RootRenderObject(this, width, height))->getHandle();
-	_uta = new MicroTileArray(width, height);
+	_uta = new Graphics::MicroTileArray(width, height);
 	_currQueue = new RenderObjectQueue();
 	_prevQueue = new RenderObjectQueue();
 }
@@ -73,6 +73,7 @@ RenderObjectManager::~RenderObjectManager() {
 	delete _uta;
 	delete _currQueue;
 	delete _prevQueue;
+	_staticLayer.free();
 }
 
 void RenderObjectManager::startFrame() {
@@ -101,29 +102,55 @@ bool RenderObjectManager::render() {
 	_currQueue->clear();
 	_rootPtr->preRender(_currQueue);
 
-	_uta->clear();
+	Graphics::Surface *backSurface = Kernel::getInstance()->getGfx()->getSurface();
+
+	// Static bitmaps and panels drawn before anything else make up the static layer
+	RenderObjectQueue staticQueue;
+	for (RenderObjectQueue::iterator it = _currQueue->begin(); it != _currQueue->end(); ++it) {
+		const RenderObject::TYPES type = (*it)._renderObject->getType();
+		if (type != RenderObject::TYPE_ROOT && type != RenderObject::TYPE_STATICBITMAP && type != RenderObject::TYPE_PANEL)
+			break;
+		staticQueue.push_back(*it);
+	}
 
-	// Add rectangles of objects which don't exist in this frame any more
-	for (RenderObjectQueue::iterator it = _prevQueue->begin(); it != _prevQueue->end(); ++it) {
-		if (!_currQueue->exists(*it))
-			_uta->addRect((*it)._bbox);
+	bool staticLayerChanged = staticQueue.size() != _staticLayerQueue.size();
+	RenderObjectQueue::iterator cachedIt = _staticLayerQueue.begin();
+	for (RenderObjectQueue::iterator it = staticQueue.begin(); !staticLayerChanged && it != staticQueue.end(); ++it, ++cachedIt) {
+		staticLayerChanged = (*it)._renderObject != (*cachedIt)._renderObject ||
+			(*it)._version != (*cachedIt)._version ||
+			(*it)._bbox != (*cachedIt)._bbox;
 	}
 
-	// Add rectangles of objects which are different from the previous frame
-	for (RenderObjectQueue::iterator it = _currQueue->begin(); it != _currQueue->end(); ++it) {
-		if (!_prevQueue->exists(*it))
-			_uta->addRect((*it)._bbox);
+	_uta->clear();
+
+	if (staticLayerChanged) {
+		// Compositing the layer overwrites the whole back buffer
+		rebuildStaticLayer(staticQueue);
+		_uta->addRect(Common::Rect(backSurface->w, backSurface->h));
+	} else {
+		// Add rectangles of objects which don't exist in this frame any more
+		for (RenderObjectQueue::iterator it = _prevQueue->begin(); it != _prevQueue->end(); ++it) {
+			if (!_currQueue->exists(*it))
+				_uta->addRect((*it)._bbox);
+		}
+
+		// Add rectangles of objects which are different from the previous frame
+		for (RenderObjectQueue::iterator it = _currQueue->begin(); it != _currQueue->end(); ++it) {
+			if (!_prevQueue->exists(*it))
+				_uta->addRect((*it)._bbox);
+		}
 	}
 
-	RectangleList *updateRects = _uta->getRectangles();
+	RectangleList updateRects;
+	_uta->getRectangles(updateRects);
 	Common::Array<int> updateRectsMinZ;
 
-	updateRectsMinZ.reserve(updateRects->size());
+	updateRectsMinZ.reserve(updateRects.size());
 
 	// Calculate the minimum drawing Z value of each update rectangle
 	// Solid bitmaps with a Z order less than the value calculated here would be overdrawn again and
 	// so don't need to be drawn in the first place which speeds things up a bit.
-	for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
+	for (RectangleList::iterator rectIt = updateRects.begin(); rectIt != updateRects.end(); ++rectIt) {
 		int minZ = 0;
 		for (RenderObjectQueue::iterator it = _currQueue->reverse_begin(); it != _currQueue->end(); --it) {
 			if ((*it)._renderObject->isVisible() && (*it)._renderObject->isSolid() &&
@@ -135,10 +162,21 @@ bool RenderObjectManager::render() {
 		updateRectsMinZ.push_back(minZ);
 	}
 
-	if (_rootPtr->render(updateRects, updateRectsMinZ)) {
+	// Restore the static layer and only draw what lies above it
+	for (RectangleList::iterator rectIt = updateRects.begin(); rectIt != updateRects.end(); ++rectIt)
+		backSurface->copyRectToSurface(_staticLayer, (*rectIt).left, (*rectIt).top, *rectIt);
+
+	for (RenderObjectQueue::iterator it = staticQueue.begin(); it != staticQueue.end(); ++it)
+		(*it)._renderObject->setInStaticLayer(true);
+
+	const bool renderResult = _rootPtr->render(&updateRects, updateRectsMinZ);
+
+	for (RenderObjectQueue::iterator it = staticQueue.begin(); it != staticQueue.end(); ++it)
+		(*it)._renderObject->setInStaticLayer(false);
+
+	if (renderResult) {
 		// Copy updated rectangles to the video screen
-		Graphics::Surface *backSurface = Kernel::getInstance()->getGfx()->getSurface();
-		for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
+		for (RectangleList::iterator rectIt = updateRects.begin(); rectIt != updateRects.end(); ++rectIt) {
 			const int x = (*rectIt).left;
 			const int y = (*rectIt).top;
 			const int width = (*rectIt).width();
@@ -147,13 +185,32 @@ bool RenderObjectManager::render() {
 		}
 	}
 
-	delete updateRects;
-
 	SWAP(_currQueue, _prevQueue);
 
 	return true;
 }
 
+void RenderObjectManager::rebuildStaticLayer(const RenderObjectQueue &staticQueue) {
+	Graphics::Surface *backSurface = Kernel::getInstance()->getGfx()->getSurface();
+
+	if (_staticLayer.w != backSurface->w || _staticLayer.h != backSurface->h || _staticLayer.format != backSurface->format) {
+		_staticLayer.free();
+		_staticLayer.create(backSurface->w, backSurface->h, backSurface->format);
+	}
+
+	// Composite the static objects over an empty back buffer and keep a copy
+	const Common::Rect fullRect(backSurface->w, backSurface->h);
+	backSurface->fillRect(fullRect, 0);
+
+	RectangleList fullScreen;
+	fullScreen.push_back(fullRect);
+	for (RenderObjectQueue::const_iterator it = staticQueue.begin(); it != staticQueue.end(); ++it)
+		(*it)._renderObject->renderSelf(&fullScreen);
+
+	_staticLayer.copyRectToSurface(*backSurface, 0, 0, fullRect);
+	_staticLayerQueue = staticQueue;
+}
+
 void RenderObjectManager::attatchTimedRenderObject(RenderObjectPtr<TimedRenderObject> renderObjectPtr) {
 	_timedRenderObjects.push_back(renderObjectPtr);
 }
@@ -47,10 +47,14 @@
 #include "sword25/gfx/renderobjectptr.h"
 #include "sword25/kernel/persistable.h"
 
-#include "sword25/gfx/microtiles.h"
+#include "graphics/microtiles.h"
+#include "graphics/surface.h"
 
 namespace Sword25 {
 
+class RectangleList : public Common::List<Common::Rect> {
+};
+
 class Kernel;
 class RenderObject;
 class TimedRenderObject;
@@ -131,9 +135,17 @@ private:
 	typedef Common::Array<RenderObjectPtr<TimedRenderObject> > RenderObjectList;
 	RenderObjectList _timedRenderObjects;
 
-	MicroTileArray *_uta;
+	Graphics::MicroTileArray *_uta;
 	RenderObjectQueue *_currQueue, *_prevQueue;
 
+	// The static bitmaps and panels at the start of the render queue are
+	// composited once into this layer. Each frame the update rectangles are
+	// restored from it and only the objects above are drawn.
+	Graphics::Surface _staticLayer;
+	RenderObjectQueue _staticLayerQueue;
+
+	void rebuildStaticLayer(const RenderObjectQueue &staticQueue);
+
 	// RenderObject-Tree Variablen
 	// ---------------------------
 	// Der Baum legt die hierachische Ordnung der BS_RenderObjects fest.
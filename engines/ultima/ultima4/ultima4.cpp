@@ -202,6 +202,11 @@ void Ultima4Engine::setToJourneyOnwards() {
 	assert(_saveSlotToLoad);
 }
 
+bool Ultima4Engine::hasFeature(EngineFeature f) const {
+	// saveGameState() only adds the last_save entry for manual saves
+	return (f == kSupportsBackgroundSaving) || Shared::UltimaEngine::hasFeature(f);
+}
+
 bool Ultima4Engine::canLoadGameStateCurrently(bool isAutosave) {
 	return g_game != nullptr && g_context != nullptr && eventHandler->getController() == g_game;
 }
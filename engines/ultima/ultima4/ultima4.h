@@ -95,6 +95,11 @@ public:
 	Ultima4Engine(OSystem *syst, const Ultima::UltimaGameDescription *gameDesc);
 	~Ultima4Engine() override;
 
+	/**
+	 * Returns true if the given feature is supported
+	 */
+	bool hasFeature(EngineFeature f) const override;
+
 	/**
 	 * Returns true if a savegame can be loaded
 	 */
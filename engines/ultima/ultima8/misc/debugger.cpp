@@ -769,7 +769,7 @@ bool Debugger::cmdDumpMap(int argc, const char **argv) {
 	// Now render the map
 	for (int32 y = 0; y < 64; y++) {
 		for (int32 x = 0; x < 64; x++) {
-			const Std::list<Item *> *list =
+			const Std::vector<Item *> *list =
 				World::get_instance()->getCurrentMap()->getItemList(x, y);
 
 			// Should iterate the items!
@@ -830,6 +830,11 @@ void Ultima8Engine::writeSaveInfo(Common::WriteStream *ws) {
 	_game->writeSaveInfo(ws);
 }
 
+bool Ultima8Engine::hasFeature(EngineFeature f) const {
+	// The lastSave setting saveGameState() maintains is left alone by autosaves
+	return (f == kSupportsBackgroundSaving) || Shared::UltimaEngine::hasFeature(f);
+}
+
 bool Ultima8Engine::canSaveGameStateCurrently(bool isAutosave) {
 	if (_desktopGump->FindGump<ModalGump>() || _avatarInStasis)
 		// Can't save when a modal gump is open, or avatar in statsis  during cutscenes
@@ -278,6 +278,11 @@ public:
 	 */
 	void syncSoundSettings() override;
 
+	/**
+	 * Returns true if the given feature is supported
+	 */
+	bool hasFeature(EngineFeature f) const override;
+
 	/**
 	 * Returns true if a savegame can be loaded
 	 */
@@ -40,7 +40,7 @@
 namespace Ultima {
 namespace Ultima8 {
 
-typedef Std::list<Item *> item_list;
+typedef Std::vector<Item *> item_list;
 
 static const int INT_MAX_VALUE = 0x7fffffff;
 
@@ -154,7 +154,7 @@ void CurrentMap::writeback() {
 }
 
 void CurrentMap::loadItems(const Std::list<Item *> &itemlist, bool callCacheIn) {
-	item_list::const_iterator iter;
+	Std::list<Item *>::const_iterator iter;
 	for (iter = itemlist.begin(); iter != itemlist.end(); ++iter) {
 		Item *item = *iter;
 
@@ -233,7 +233,7 @@ void CurrentMap::addItem(Item *item) {
 	int32 cx = ix / _mapChunkSize;
 	int32 cy = iy / _mapChunkSize;
 
-	_items[cx][cy].push_front(item);
+	_items[cx][cy].insert_at(0, item);
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -368,7 +368,13 @@ void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
 	int32 cx = oldx / _mapChunkSize;
 	int32 cy = oldy / _mapChunkSize;
 
-	_items[cx][cy].remove(item);
+	item_list &items = _items[cx][cy];
+	for (uint i = 0; i < items.size(); ++i) {
+		if (items[i] == item) {
+			items.remove_at(i);
+			break;
+		}
+	}
 	item->clearExtFlag(Item::EXT_INCURMAP);
 }
 
@@ -477,21 +483,35 @@ void CurrentMap::updateFastArea(int32 from_x, int32 from_y, int32 from_z, int32
 void CurrentMap::setChunkFast(int32 cx, int32 cy) {
 	_fast[cy][cx / 32] |= 1 << (cx & 31);
 
-	item_list::iterator iter;
-	for (iter = _items[cx][cy].begin();
-	        iter != _items[cx][cy].end(); ++iter) {
-		(*iter)->enterFastArea();
+	// Usecode run here can add items to this chunk, such as the contents
+	// of a glob egg, or remove them. Walk a snapshot of the object ids so
+	// every item present now is entered exactly once, and skip those that
+	// got destroyed in the meantime.
+	const item_list &items = _items[cx][cy];
+	Std::vector<ObjId> snapshot;
+	snapshot.reserve(items.size());
+	for (uint i = 0; i < items.size(); ++i)
+		snapshot.push_back(items[i]->getObjId());
+
+	for (uint i = 0; i < snapshot.size(); ++i) {
+		Item *item = getItem(snapshot[i]);
+		if (item)
+			item->enterFastArea();
 	}
 }
 
 void CurrentMap::unsetChunkFast(int32 cx, int32 cy) {
 	_fast[cy][cx / 32] &= ~(1 << (cx & 31));
 
-	item_list::iterator iter = _items[cx][cy].begin();
-	while (iter != _items[cx][cy].end()) {
-		Item *item = *iter;
-		++iter;
+	const item_list &items = _items[cx][cy];
+	uint i = 0;
+	while (i < items.size()) {
+		Item *item = items[i];
 		item->leaveFastArea();  // Can destroy the item
+
+		// A destroyed item removes itself, moving the next one into its slot
+		if (i < items.size() && items[i] == item)
+			++i;
 	}
 }
 
@@ -666,7 +686,7 @@ TeleportEgg *CurrentMap::findDestination(uint16 id) {
 	return nullptr;
 }
 
-const Std::list<Item *> *CurrentMap::getItemList(int32 gx, int32 gy) const {
+const Std::vector<Item *> *CurrentMap::getItemList(int32 gx, int32 gy) const {
 	if (gx < 0 || gy < 0 || gx >= MAP_NUM_CHUNKS || gy >= MAP_NUM_CHUNKS)
 		return nullptr;
 	return &_items[gx][gy];
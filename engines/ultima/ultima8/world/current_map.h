@@ -195,7 +195,7 @@ public:
 	TeleportEgg *findDestination(uint16 id);
 
 	// Not allowed to modify the list. Remember to use const_iterator
-	const Std::list<Item *> *getItemList(int32 gx, int32 gy) const;
+	const Std::vector<Item *> *getItemList(int32 gx, int32 gy) const;
 
 	bool isChunkFast(int32 cx, int32 cy) const {
 		// CONSTANTS!
@@ -227,7 +227,9 @@ private:
 
 	// item lists. Lots of them :-)
 	// items[x][y]
-	Std::list<Item *> _items[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
+	// These are arrays rather than linked lists, so the collision and search
+	// queries walk contiguous memory.
+	Std::vector<Item *> _items[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
 
 	ProcId _eggHatcher;
 
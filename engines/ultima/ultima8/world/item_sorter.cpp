@@ -39,10 +39,20 @@
 namespace Ultima {
 namespace Ultima8 {
 
+// Size in pixels of a cell of the screenspace grid
+static const int32 GRID_CELL_SIZE = 64;
+
+struct SortItemDependsNode {
+	SortItemDependsNode *_next;
+	SortItemDependsNode *_prev;
+	SortItem            *val;
+	SortItemDependsNode() : _next(nullptr), _prev(nullptr), val(nullptr) { }
+};
+
 // This does NOT need to be in the header
 struct SortItem {
-	SortItem(SortItem *n) : _next(n), _prev(nullptr), _itemNum(0),
-			_shape(nullptr), _order(-1), _depends(), _shapeNum(0),
+	SortItem(SortItem *n, SortItemDependsNode **dependsUnused) : _next(n), _prev(nullptr), _itemNum(0),
+			_shape(nullptr), _order(-1), _gridStamp(0), _depends(dependsUnused), _shapeNum(0),
 			_frame(0), _flags(0), _extFlags(0), _sx(0), _sy(0),
 			_sx2(0), _sy2(0), _x(0), _y(0), _z(0), _xLeft(0),
 			_yFar(0), _zTop(0), _sxLeft(0), _sxRight(0), _sxTop(0),
@@ -114,22 +124,21 @@ struct SortItem {
 
 	int32   _order;      // Rendering _order. -1 is not yet drawn
 
+	uint32  _gridStamp;  // Set to the sorter's stamp when sharing a grid cell with the item being added
+
 	// Note that Std::priority_queue could be used here, BUT there is no guarentee that it's implementation
 	// will be friendly to insertions
 	// Alternatively i could use Std::list, BUT there is no guarentee that it will keep wont delete
 	// the unused nodes after doing a clear
 	// So the only reasonable solution is to write my own list
+	// Unused nodes are kept in a free list owned by the ItemSorter and shared
+	// between all SortItems
 	struct DependsList {
-		struct Node {
-			Node        *_next;
-			Node        *_prev;
-			SortItem    *val;
-			Node() : _next(nullptr), _prev(nullptr), val(nullptr) { }
-		};
+		typedef SortItemDependsNode Node;
 
 		Node *list;
 		Node *tail;
-		Node *unused;
+		Node **unused;
 
 		struct iterator {
 			Node *n;
@@ -155,17 +164,17 @@ struct SortItem {
 
 		void clear() {
 			if (tail) {
-				tail->_next = unused;
-				unused = list;
+				tail->_next = *unused;
+				*unused = list;
 				tail = nullptr;
 				list = nullptr;
 			}
 		}
 
 		void push_back(SortItem *other) {
-			if (!unused) unused = new Node();
-			Node *nn = unused;
-			unused = unused->_next;
+			if (!*unused) *unused = new Node();
+			Node *nn = *unused;
+			*unused = nn->_next;
 			nn->val = other;
 
 			// Put it at the end
@@ -177,9 +186,9 @@ struct SortItem {
 		}
 
 		void insert_sorted(SortItem *other) {
-			if (!unused) unused = new Node();
-			Node *nn = unused;
-			unused = unused->_next;
+			if (!*unused) *unused = new Node();
+			Node *nn = *unused;
+			*unused = nn->_next;
 			nn->val = other;
 
 			for (Node *n = list; n != nullptr; n = n->_next) {
@@ -202,15 +211,10 @@ struct SortItem {
 			tail = nn;
 		}
 
-		DependsList() : list(nullptr), tail(nullptr), unused(nullptr) { }
+		DependsList(Node **pool) : list(nullptr), tail(nullptr), unused(pool) { }
 
 		~DependsList() {
 			clear();
-			while (unused)  {
-				Node *n = unused->_next;
-				delete unused;
-				unused = n;
-			}
 		}
 	};
 
@@ -581,9 +585,11 @@ inline bool SortItem::operator<<(const SortItem &si2) const {
 
 ItemSorter::ItemSorter() :
 	_shapes(nullptr), _surf(nullptr), _items(nullptr), _itemsTail(nullptr),
-	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0) {
+	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0),
+	_gridLeft(0), _gridTop(0), _gridWidth(0), _gridHeight(0), _gridStamp(0),
+	_dependsUnused(nullptr) {
 	int i = 2048;
-	while (i--) _itemsUnused = new SortItem(_itemsUnused);
+	while (i--) _itemsUnused = new SortItem(_itemsUnused, &_dependsUnused);
 }
 
 ItemSorter::~ItemSorter() {
@@ -602,6 +608,12 @@ ItemSorter::~ItemSorter() {
 	}
 
 	delete [] _items;
+
+	while (_dependsUnused) {
+		SortItemDependsNode *next = _dependsUnused->_next;
+		delete _dependsUnused;
+		_dependsUnused = next;
+	}
 }
 
 void ItemSorter::BeginDisplayList(RenderSurface *rs,
@@ -625,13 +637,36 @@ void ItemSorter::BeginDisplayList(RenderSurface *rs,
 	_camSx = (camx - camy) / 4;
 	// Screenspace bounding box bottom extent  (RNB y coord)
 	_camSy = (camx + camy) / 8 - camz;
+
+	// Cover the clipping window with the grid. Items reaching outside it are
+	// clamped into the border cells.
+	Rect clipWindow;
+	_surf->GetClippingRect(clipWindow);
+	_gridLeft = clipWindow.left;
+	_gridTop = clipWindow.top;
+	_gridWidth = MAX<int32>(1, (clipWindow.right - clipWindow.left + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+	_gridHeight = MAX<int32>(1, (clipWindow.bottom - clipWindow.top + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+
+	// Resizing to 0 keeps the storage of each cell for the next frame
+	_grid.resize(_gridWidth * _gridHeight);
+	for (uint i = 0; i < _grid.size(); ++i)
+		_grid[i].resize(0);
+}
+
+void ItemSorter::GetGridCells(const SortItem *si, int32 &x1, int32 &y1, int32 &x2, int32 &y2) const {
+	// SortItem::overlap can only succeed when the screenspace extents
+	// intersect, so the extents bound the cells that need checking
+	x1 = CLIP<int32>((si->_sxLeft - _gridLeft) / GRID_CELL_SIZE, 0, _gridWidth - 1);
+	x2 = CLIP<int32>((si->_sxRight - _gridLeft) / GRID_CELL_SIZE, 0, _gridWidth - 1);
+	y1 = CLIP<int32>((si->_syTop - _gridTop) / GRID_CELL_SIZE, 0, _gridHeight - 1);
+	y2 = CLIP<int32>((si->_syBot - _gridTop) / GRID_CELL_SIZE, 0, _gridHeight - 1);
 }
 
 void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 frame_num, uint32 flags, uint32 ext_flags, uint16 itemNum) {
 
 	// First thing, get a SortItem to use (first of unused)
 	if (!_itemsUnused)
-		_itemsUnused = new SortItem(0);
+		_itemsUnused = new SortItem(0, &_dependsUnused);
 	SortItem *si = _itemsUnused;
 
 	si->_itemNum = itemNum;
@@ -711,6 +746,18 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 	// are never deleted
 	si->_depends.clear();
 
+	// Mark the items sharing a grid cell with us; nothing else can overlap
+	int32 cellX1, cellY1, cellX2, cellY2;
+	GetGridCells(si, cellX1, cellY1, cellX2, cellY2);
+	_gridStamp++;
+	for (int32 cy = cellY1; cy <= cellY2; cy++) {
+		for (int32 cx = cellX1; cx <= cellX2; cx++) {
+			const Std::vector<SortItem *> &cell = _grid[cy * _gridWidth + cx];
+			for (uint i = 0; i < cell.size(); ++i)
+				cell[i]->_gridStamp = _gridStamp;
+		}
+	}
+
 	// Iterate the list and compare _shapes
 
 	// Ok,
@@ -721,7 +768,7 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 			addpoint = si2;
 
 		// Doesn't overlap
-		if (si2->_occluded || !si->overlap(*si2))
+		if (si2->_gridStamp != _gridStamp || si2->_occluded || !si->overlap(*si2))
 			continue;
 
 		// Attempt to find which is infront
@@ -748,6 +795,11 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
 
+	for (int32 cy = cellY1; cy <= cellY2; cy++) {
+		for (int32 cx = cellX1; cx <= cellX2; cx++)
+			_grid[cy * _gridWidth + cx].push_back(si);
+	}
+
 	// have a position
 	//addpoint = 0;
 	if (addpoint) {
@@ -23,6 +23,8 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "ultima/shared/std/containers.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
@@ -30,6 +32,7 @@ class MainShapeArchive;
 class Item;
 class RenderSurface;
 struct SortItem;
+struct SortItemDependsNode;
 
 class ItemSorter {
 	MainShapeArchive    *_shapes;
@@ -44,6 +47,17 @@ class ItemSorter {
 
 	int32       _camSx, _camSy;
 
+	// Screenspace grid of cells, each listing the items whose bounding box
+	// touches it. Only items sharing a cell can overlap, so AddItem uses it
+	// to skip the full comparison against everything else.
+	Std::vector<Std::vector<SortItem *> > _grid;
+	int32       _gridLeft, _gridTop;
+	int32       _gridWidth, _gridHeight;
+	uint32      _gridStamp;
+
+	// Free dependency list nodes, shared by all SortItems
+	SortItemDependsNode *_dependsUnused;
+
 public:
 	ItemSorter();
 	~ItemSorter();
@@ -74,6 +88,7 @@ public:
 
 private:
 	bool PaintSortItem(SortItem *);
+	void GetGridCells(const SortItem *si, int32 &x1, int32 &y1, int32 &x2, int32 &y2) const;
 	bool NullPaintSortItem(SortItem *);
 };
 
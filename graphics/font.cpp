@@ -24,10 +24,83 @@
 #include "graphics/managed_surface.h"
 
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/util.h"
 
 namespace Graphics {
 
+namespace {
+
+template<class StringType>
+struct WrappedText {
+	int maxWidth;
+	int initWidth;
+	uint32 mode;
+	int result;
+	Common::Array<StringType> lines;
+};
+
+template<class StringType>
+struct TextLayoutCache {
+	// Drop everything once this many strings have been cached
+	static const uint kMaxStrings = 512;
+	// Keep only the most recent wrappings of a string, which is wrapped
+	// at a new width every time a resizable dialog changes size
+	static const uint kMaxWrapsPerString = 4;
+
+	typedef Common::HashMap<StringType, int> WidthMap;
+	typedef Common::HashMap<StringType, Common::Array<WrappedText<StringType> > > WrapMap;
+
+	WidthMap widths;
+	WrapMap wraps;
+
+	int getStringWidth(const Font &font, const StringType &str);
+	int wordWrapText(const Font &font, const StringType &str, int maxWidth, Common::Array<StringType> &lines, int initWidth, uint32 mode);
+
+	void clear() {
+		widths.clear(true);
+		wraps.clear(true);
+	}
+};
+
+} // End of anonymous namespace
+
+struct Font::LayoutCache {
+	TextLayoutCache<Common::String> strings;
+	TextLayoutCache<Common::U32String> u32Strings;
+};
+
+Font::Font(const Font &font) : _layoutCache(nullptr) {
+	// The cached results are not copied, only whether caching is enabled
+	if (font._layoutCache)
+		enableLayoutCache();
+}
+
+Font::~Font() {
+	delete _layoutCache;
+}
+
+Font &Font::operator=(const Font &font) {
+	if (this != &font) {
+		delete _layoutCache;
+		_layoutCache = font._layoutCache ? new LayoutCache() : nullptr;
+	}
+	return *this;
+}
+
+void Font::enableLayoutCache() {
+	if (!_layoutCache)
+		_layoutCache = new LayoutCache();
+}
+
+void Font::clearLayoutCache() const {
+	if (_layoutCache) {
+		_layoutCache->strings.clear();
+		_layoutCache->u32Strings.clear();
+	}
+}
+
 int Font::getKerningOffset(uint32 left, uint32 right) const {
 	return 0;
 }
@@ -392,6 +465,51 @@ StringType handleEllipsis(const Font &font, const StringType &input, int w) {
 	return s;
 }
 
+template<class StringType>
+int TextLayoutCache<StringType>::getStringWidth(const Font &font, const StringType &str) {
+	typename WidthMap::const_iterator entry = widths.find(str);
+	if (entry != widths.end())
+		return entry->_value;
+
+	if (widths.size() >= kMaxStrings)
+		widths.clear(true);
+
+	int width = getStringWidthImpl(font, str);
+	widths[str] = width;
+	return width;
+}
+
+template<class StringType>
+int TextLayoutCache<StringType>::wordWrapText(const Font &font, const StringType &str, int maxWidth, Common::Array<StringType> &lines, int initWidth, uint32 mode) {
+	typename WrapMap::iterator entry = wraps.find(str);
+	if (entry != wraps.end()) {
+		Common::Array<WrappedText<StringType> > &wrappings = entry->_value;
+		for (uint i = 0; i < wrappings.size(); ++i) {
+			const WrappedText<StringType> &wrapped = wrappings[i];
+			if (wrapped.maxWidth == maxWidth && wrapped.initWidth == initWidth && wrapped.mode == mode) {
+				lines.push_back(wrapped.lines);
+				return wrapped.result;
+			}
+		}
+
+		// Wrappings are appended, so the first one is the oldest
+		if (wrappings.size() >= kMaxWrapsPerString)
+			wrappings.remove_at(0);
+	} else if (wraps.size() >= kMaxStrings) {
+		wraps.clear(true);
+	}
+
+	WrappedText<StringType> wrapped;
+	wrapped.maxWidth = maxWidth;
+	wrapped.initWidth = initWidth;
+	wrapped.mode = mode;
+	wrapped.result = wordWrapTextImpl(font, str, maxWidth, wrapped.lines, initWidth, mode);
+
+	lines.push_back(wrapped.lines);
+	wraps[str].push_back(wrapped);
+	return wrapped.result;
+}
+
 } // End of anonymous namespace
 
 Common::Rect Font::getBoundingBox(const Common::String &input, int x, int y, const int w, TextAlign align, int deltax, bool useEllipsis) const {
@@ -435,10 +553,14 @@ Common::Rect Font::getBoundingBox(const Common::U32String &input, int x, int y,
 }
 
 int Font::getStringWidth(const Common::String &str) const {
+	if (_layoutCache)
+		return _layoutCache->strings.getStringWidth(*this, str);
 	return getStringWidthImpl(*this, str);
 }
 
 int Font::getStringWidth(const Common::U32String &str) const {
+	if (_layoutCache)
+		return _layoutCache->u32Strings.getStringWidth(*this, str);
 	return getStringWidthImpl(*this, str);
 }
 
@@ -475,10 +597,14 @@ void Font::drawString(ManagedSurface *dst, const Common::U32String &str, int x,
 }
 
 int Font::wordWrapText(const Common::String &str, int maxWidth, Common::Array<Common::String> &lines, int initWidth, uint32 mode) const {
+	if (_layoutCache)
+		return _layoutCache->strings.wordWrapText(*this, str, maxWidth, lines, initWidth, mode);
 	return wordWrapTextImpl(*this, str, maxWidth, lines, initWidth, mode);
 }
 
 int Font::wordWrapText(const Common::U32String &str, int maxWidth, Common::Array<Common::U32String> &lines, int initWidth, uint32 mode) const {
+	if (_layoutCache)
+		return _layoutCache->u32Strings.wordWrapText(*this, str, maxWidth, lines, initWidth, mode);
 	return wordWrapTextImpl(*this, str, maxWidth, lines, initWidth, mode);
 }
 
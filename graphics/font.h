@@ -82,8 +82,11 @@ TextAlign convertTextAlignH(TextAlign alignH, bool rtl);
  */
 class Font {
 public:
-	Font() {}
-	virtual ~Font() {}
+	Font() : _layoutCache(nullptr) {}
+	Font(const Font &font);
+	virtual ~Font();
+
+	Font &operator=(const Font &font);
 
 	/**
 	 * Return the height of the font.
@@ -239,6 +242,27 @@ public:
 	/** @overload */
 	int wordWrapText(const Common::U32String &str, int maxWidth, Common::Array<Common::U32String> &lines, int initWidth = 0, uint32 mode = kWordWrapOnExplicitNewLines) const;
 
+	/**
+	 * Discard the cached string widths and word wrapping results.
+	 *
+	 * This must be called whenever the metrics of a font with an enabled
+	 * layout cache change.
+	 */
+	void clearLayoutCache() const;
+
+protected:
+	/**
+	 * Enable caching of the results of getStringWidth and wordWrapText.
+	 *
+	 * Repeatedly measuring or wrapping the same strings then becomes a hash
+	 * lookup. Only fonts whose metrics do not change after creation should
+	 * enable this, or they need to call clearLayoutCache when they do.
+	 */
+	void enableLayoutCache();
+
+private:
+	struct LayoutCache;
+	mutable LayoutCache *_layoutCache;
 };
 /** @} */
 } // End of namespace Graphics
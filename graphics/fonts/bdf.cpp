@@ -32,6 +32,7 @@ namespace Graphics {
 
 BdfFont::BdfFont(const BdfFontData &data, DisposeAfterUse::Flag dispose)
 	: _data(data), _dispose(dispose) {
+	enableLayoutCache();
 }
 
 BdfFont::~BdfFont() {
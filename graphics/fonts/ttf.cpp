@@ -168,17 +168,56 @@ private:
 	int _ascent, _descent;
 
 	struct Glyph {
-		Surface image;
+		Surface image; ///< Only used for glyphs which do not fit into an atlas cell
 		int xOffset, yOffset;
+		int width, height;
 		int advance;
 		FT_UInt slot;
+		int cell; ///< Atlas cell holding the glyph bitmap, -1 if not rasterized
 	};
 
-	bool cacheGlyph(Glyph &glyph, uint32 chr) const;
+	bool cacheGlyph(Glyph &glyph, uint32 key, uint32 chr) const;
+	bool rasterizeGlyph(Glyph &glyph, uint32 key, bool store) const;
 	typedef Common::HashMap<uint32, Glyph> GlyphCache;
 	mutable GlyphCache _glyphs;
 	bool _allowLateCaching;
-	void assureCached(uint32 chr) const;
+	Glyph *findGlyph(uint32 chr) const;
+	const uint8 *getGlyphPixels(Glyph &glyph, uint32 key, int &pitch) const;
+
+	/**
+	 * The glyph bitmaps are stored in an atlas made of equally sized cells,
+	 * rasterized when a glyph is first drawn. The atlas grows by pages of
+	 * cells up to a memory limit. When all the cells are in use, the least
+	 * recently drawn glyph is evicted and rasterized again when needed.
+	 */
+	struct AtlasCell {
+		uint32 key;
+		uint32 lastUse;
+		bool used;
+	};
+
+	enum {
+		kAtlasPageCells = 16,
+		kMaxAtlasSize = 4 * 1024 * 1024,
+		kMaxKerningPairs = 4096
+	};
+
+	void initAtlas();
+	void freeAtlas();
+	int allocateAtlasCell(uint32 key) const;
+	uint8 *getCellPixels(int cell) const;
+
+	mutable Common::Array<Surface> _atlasPages;
+	mutable Common::Array<AtlasCell> _atlasCells;
+	uint _maxAtlasPages;
+	int _cellWidth, _cellHeight;
+	mutable uint32 _atlasUseCounter;
+
+	struct KerningPairHash {
+		uint operator()(uint64 pair) const { return (uint)(pair >> 32) * 31 + (uint)pair; }
+	};
+	typedef Common::HashMap<uint64, int, KerningPairHash> KerningCache;
+	mutable KerningCache _kerningPairs;
 
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
@@ -197,7 +236,9 @@ private:
 TTFFont::TTFFont()
     : _initialized(false), _face(), _ttfFile(0), _size(0), _width(0), _height(0), _ascent(0),
       _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
-      _hasKerning(false), _allowLateCaching(false), _fakeBold(false), _fakeItalic(false) {
+      _hasKerning(false), _allowLateCaching(false), _fakeBold(false), _fakeItalic(false),
+      _maxAtlasPages(0), _cellWidth(0), _cellHeight(0), _atlasUseCounter(0) {
+	enableLayoutCache();
 }
 
 TTFFont::~TTFFont() {
@@ -210,6 +251,8 @@ TTFFont::~TTFFont() {
 		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
 			i->_value.image.free();
 
+		freeAtlas();
+
 		_initialized = false;
 	}
 }
@@ -348,13 +391,15 @@ bool TTFFont::load(uint8 *ttfFile, uint32 sizeFile, int32 faceIndex, bool bold,
 		_loadFlags |= FT_LOAD_NO_BITMAP;
 	}
 
+	initAtlas();
+
 	if (!mapping) {
 		// Allow loading of all unicode characters.
 		_allowLateCaching = true;
 
 		// Load all ISO-8859-1 characters.
 		for (uint i = 0; i < 256; ++i) {
-			if (!cacheGlyph(_glyphs[i], i)) {
+			if (!cacheGlyph(_glyphs[i], i, i)) {
 				_glyphs.erase(i);
 			}
 		}
@@ -367,10 +412,11 @@ bool TTFFont::load(uint8 *ttfFile, uint32 sizeFile, int32 faceIndex, bool bold,
 			const bool isRequired = (mapping[i] & 0x80000000) != 0;
 			// Check whether loading an important glyph fails and error out if
 			// that is the case.
-			if (!cacheGlyph(_glyphs[i], unicode)) {
+			if (!cacheGlyph(_glyphs[i], i, unicode)) {
 				_glyphs.erase(i);
 				if (isRequired) {
 					g_ttf.closeFont(_face);
+					freeAtlas();
 
 					// Don't delete ttfFile as we return fail
 					_ttfFile = 0;
@@ -383,6 +429,7 @@ bool TTFFont::load(uint8 *ttfFile, uint32 sizeFile, int32 faceIndex, bool bold,
 
 	if (_glyphs.size() == 0) {
 		g_ttf.closeFont(_face);
+		freeAtlas();
 
 		// Don't delete ttfFile as we return fail
 		_ttfFile = 0;
@@ -526,56 +573,45 @@ int TTFFont::getMaxCharWidth() const {
 }
 
 int TTFFont::getCharWidth(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyph = findGlyph(chr);
+	if (!glyph)
 		return 0;
 	else
-		return glyphEntry->_value.advance;
+		return glyph->advance;
 }
 
 int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
-	assureCached(left);
-	assureCached(right);
-
-	FT_UInt leftGlyph, rightGlyph;
-	GlyphCache::const_iterator glyphEntry;
+	const uint64 pair = ((uint64)left << 32) | right;
+	KerningCache::const_iterator kerningEntry = _kerningPairs.find(pair);
+	if (kerningEntry != _kerningPairs.end())
+		return kerningEntry->_value;
 
-	glyphEntry = _glyphs.find(left);
-	if (glyphEntry != _glyphs.end()) {
-		leftGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
-	}
+	const Glyph *leftGlyph = findGlyph(left);
+	const Glyph *rightGlyph = findGlyph(right);
 
-	glyphEntry = _glyphs.find(right);
-	if (glyphEntry != _glyphs.end()) {
-		rightGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
+	int offset = 0;
+	if (leftGlyph && rightGlyph && leftGlyph->slot && rightGlyph->slot) {
+		FT_Vector kerningVector;
+		FT_Get_Kerning(_face, leftGlyph->slot, rightGlyph->slot, FT_KERNING_DEFAULT, &kerningVector);
+		offset = kerningVector.x / 64;
 	}
 
-	if (!leftGlyph || !rightGlyph)
-		return 0;
-
-	FT_Vector kerningVector;
-	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
-	return (kerningVector.x / 64);
+	// Bound the cache, text rarely uses more than a few hundred pairs
+	if (_kerningPairs.size() >= kMaxKerningPairs)
+		_kerningPairs.clear();
+	_kerningPairs[pair] = offset;
+	return offset;
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end()) {
+	const Glyph *glyph = findGlyph(chr);
+	if (!glyph) {
 		return Common::Rect();
 	} else {
-		const int xOffset = glyphEntry->_value.xOffset;
-		const int yOffset = glyphEntry->_value.yOffset;
-		const Graphics::Surface &image = glyphEntry->_value.image;
-		return Common::Rect(xOffset, yOffset, xOffset + image.w, yOffset + image.h);
+		return Common::Rect(glyph->xOffset, glyph->yOffset, glyph->xOffset + glyph->width, glyph->yOffset + glyph->height);
 	}
 }
 
@@ -618,25 +654,25 @@ static void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos,
 } // End of anonymous namespace
 
 void TTFFont::drawChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	Glyph *glyph = findGlyph(chr);
+	if (!glyph)
 		return;
 
-	const Glyph &glyph = glyphEntry->_value;
-
-	x += glyph.xOffset;
-	y += glyph.yOffset;
+	x += glyph->xOffset;
+	y += glyph->yOffset;
 
 	if (x > dst->w)
 		return;
 	if (y > dst->h)
 		return;
 
-	int w = glyph.image.w;
-	int h = glyph.image.h;
+	int w = glyph->width;
+	int h = glyph->height;
 
-	const uint8 *srcPos = (const uint8 *)glyph.image.getPixels();
+	int srcPitch;
+	const uint8 *srcPos = getGlyphPixels(*glyph, chr, srcPitch);
+	if (!srcPos)
+		return;
 
 	// Make sure we are not drawing outside the screen bounds
 	if (x < 0) {
@@ -652,7 +688,7 @@ void TTFFont::drawChar(Surface *dst, uint32 chr, int x, int y, uint32 color) con
 		return;
 
 	if (y < 0) {
-		srcPos -= y * glyph.image.pitch;
+		srcPos -= y * srcPitch;
 		h += y;
 		y = 0;
 	}
@@ -681,21 +717,140 @@ void TTFFont::drawChar(Surface *dst, uint32 chr, int x, int y, uint32 color) con
 			}
 
 			dstPos += dst->pitch;
-			srcPos += glyph.image.pitch;
+			srcPos += srcPitch;
 		}
 	} else if (dst->format.bytesPerPixel == 2) {
-		renderGlyph<uint16>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+		renderGlyph<uint16>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format);
 	} else if (dst->format.bytesPerPixel == 4) {
-		renderGlyph<uint32>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+		renderGlyph<uint32>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format);
+	}
+}
+
+void TTFFont::initAtlas() {
+	// Leave room for the glyph parts exceeding the advance and the ascent,
+	// like italic overhangs and accents
+	_cellWidth = _width + _height / 4 + 2;
+	_cellHeight = _height + 2;
+
+	// Pages are only allocated once glyphs are drawn. Keep the atlas below
+	// 4MB, large point sizes get fewer pages.
+	const uint pageSize = kAtlasPageCells * _cellWidth * _cellHeight;
+	_maxAtlasPages = CLIP<uint>(kMaxAtlasSize / pageSize, 1, 1024 / kAtlasPageCells);
+}
+
+void TTFFont::freeAtlas() {
+	for (uint i = 0; i < _atlasPages.size(); ++i)
+		_atlasPages[i].free();
+	_atlasPages.clear();
+	_atlasCells.clear();
+}
+
+int TTFFont::allocateAtlasCell(uint32 key) const {
+	int cell = -1;
+	uint32 oldestUse = 0xFFFFFFFF;
+
+	for (uint i = 0; i < _atlasCells.size(); ++i) {
+		if (!_atlasCells[i].used) {
+			cell = i;
+			break;
+		}
+
+		if (_atlasCells[i].lastUse < oldestUse) {
+			oldestUse = _atlasCells[i].lastUse;
+			cell = i;
+		}
 	}
+
+	if ((cell < 0 || _atlasCells[cell].used) && _atlasPages.size() < _maxAtlasPages) {
+		// Add a page rather than evicting a glyph
+		_atlasPages.push_back(Surface());
+		_atlasPages.back().create(kAtlasPageCells * _cellWidth, _cellHeight, PixelFormat::createFormatCLUT8());
+
+		AtlasCell freeCell;
+		freeCell.key = 0;
+		freeCell.lastUse = 0;
+		freeCell.used = false;
+		cell = _atlasCells.size();
+		_atlasCells.resize(cell + kAtlasPageCells);
+		for (uint i = cell; i < _atlasCells.size(); ++i)
+			_atlasCells[i] = freeCell;
+	}
+
+	AtlasCell &atlasCell = _atlasCells[cell];
+	if (atlasCell.used) {
+		// Evict the least recently used glyph, it will be rasterized
+		// again when it is drawn the next time
+		GlyphCache::iterator glyphEntry = _glyphs.find(atlasCell.key);
+		if (glyphEntry != _glyphs.end())
+			glyphEntry->_value.cell = -1;
+	}
+
+	atlasCell.key = key;
+	atlasCell.lastUse = ++_atlasUseCounter;
+	atlasCell.used = true;
+	return cell;
 }
 
-bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
+uint8 *TTFFont::getCellPixels(int cell) const {
+	Surface &page = _atlasPages[cell / kAtlasPageCells];
+	return (uint8 *)page.getBasePtr(cell % kAtlasPageCells * _cellWidth, 0);
+}
+
+TTFFont::Glyph *TTFFont::findGlyph(uint32 chr) const {
+	GlyphCache::iterator glyphEntry = _glyphs.find(chr);
+	if (glyphEntry != _glyphs.end())
+		return &glyphEntry->_value;
+
+	if (!chr || !_allowLateCaching)
+		return nullptr;
+
+	Glyph newGlyph;
+	if (!cacheGlyph(newGlyph, chr, chr))
+		return nullptr;
+
+	return &(_glyphs[chr] = newGlyph);
+}
+
+const uint8 *TTFFont::getGlyphPixels(Glyph &glyph, uint32 key, int &pitch) const {
+	if (!glyph.width || !glyph.height)
+		return nullptr;
+
+	if (glyph.image.getPixels()) {
+		pitch = glyph.image.pitch;
+		return (const uint8 *)glyph.image.getPixels();
+	}
+
+	if (glyph.cell < 0) {
+		if (!rasterizeGlyph(glyph, key, true))
+			return nullptr;
+
+		// Glyphs too large for a cell get their own surface
+		if (glyph.image.getPixels()) {
+			pitch = glyph.image.pitch;
+			return (const uint8 *)glyph.image.getPixels();
+		}
+	}
+
+	_atlasCells[glyph.cell].lastUse = ++_atlasUseCounter;
+
+	pitch = _atlasPages[glyph.cell / kAtlasPageCells].pitch;
+	return getCellPixels(glyph.cell);
+}
+
+bool TTFFont::cacheGlyph(Glyph &glyph, uint32 key, uint32 chr) const {
 	FT_UInt slot = FT_Get_Char_Index(_face, chr);
 	if (!slot)
 		return false;
 
 	glyph.slot = slot;
+	glyph.cell = -1;
+
+	// Only the metrics are needed until the glyph is drawn
+	return rasterizeGlyph(glyph, key, false);
+}
+
+bool TTFFont::rasterizeGlyph(Glyph &glyph, uint32 key, bool store) const {
+	FT_UInt slot = glyph.slot;
 
 	// We use the light target and render mode to improve the looks of the
 	// glyphs. It is most noticable in FreeSansBold.ttf, where otherwise the
@@ -754,8 +909,32 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		bitmap = &_face->glyph->bitmap;
 	}
 
+	if (bitmap->pixel_mode != FT_PIXEL_MODE_MONO && bitmap->pixel_mode != FT_PIXEL_MODE_GRAY) {
+		warning("TTFFont::rasterizeGlyph: Unsupported pixel mode %d", bitmap->pixel_mode);
+#if FAKE_BOLD == 1
+		if (_fakeBold)
+			FT_Bitmap_Done(_face->glyph->library, &ownBitmap);
+#endif
+		return false;
+	}
 
-	glyph.image.create(bitmap->width, bitmap->rows, PixelFormat::createFormatCLUT8());
+	glyph.width = bitmap->width;
+	glyph.height = bitmap->rows;
+
+	uint8 *dst = nullptr;
+	int dstPitch = 0;
+	if (!store || !glyph.width || !glyph.height) {
+		// Metrics only
+	} else if (glyph.width > _cellWidth || glyph.height > _cellHeight) {
+		// Too large for the atlas, keep a separate surface for this glyph
+		glyph.image.create(bitmap->width, bitmap->rows, PixelFormat::createFormatCLUT8());
+		dst = (uint8 *)glyph.image.getPixels();
+		dstPitch = glyph.image.pitch;
+	} else {
+		glyph.cell = allocateAtlasCell(key);
+		dst = getCellPixels(glyph.cell);
+		dstPitch = _atlasPages[glyph.cell / kAtlasPageCells].pitch;
+	}
 
 	const uint8 *src = bitmap->buffer;
 	int srcPitch = bitmap->pitch;
@@ -764,13 +943,14 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		srcPitch = -srcPitch;
 	}
 
-	uint8 *dst = (uint8 *)glyph.image.getPixels();
-	memset(dst, 0, glyph.image.h * glyph.image.pitch);
+	for (int y = 0; dst && y < glyph.height; ++y)
+		memset(dst + y * dstPitch, 0, glyph.width);
 
 	switch (bitmap->pixel_mode) {
 	case FT_PIXEL_MODE_MONO:
-		for (int y = 0; y < (int)bitmap->rows; ++y) {
+		for (int y = 0; dst && y < (int)bitmap->rows; ++y) {
 			const uint8 *curSrc = src;
+			uint8 *curDst = dst;
 			uint8 mask = 0;
 
 			for (int x = 0; x < (int)bitmap->width; ++x) {
@@ -778,28 +958,27 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 					mask = *curSrc++;
 
 				if (mask & 0x80)
-					*dst = 255;
+					*curDst = 255;
 
 				mask <<= 1;
-				++dst;
+				++curDst;
 			}
 
+			dst += dstPitch;
 			src += srcPitch;
 		}
 		break;
 
 	case FT_PIXEL_MODE_GRAY:
-		for (int y = 0; y < (int)bitmap->rows; ++y) {
+		for (int y = 0; dst && y < (int)bitmap->rows; ++y) {
 			memcpy(dst, src, bitmap->width);
-			dst += glyph.image.pitch;
+			dst += dstPitch;
 			src += srcPitch;
 		}
 		break;
 
 	default:
-		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap->pixel_mode);
-		glyph.image.free();
-		return false;
+		break;
 	}
 
 #if FAKE_BOLD == 1
@@ -811,17 +990,6 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	return true;
 }
 
-void TTFFont::assureCached(uint32 chr) const {
-	if (!chr || !_allowLateCaching || _glyphs.contains(chr)) {
-		return;
-	}
-
-	Glyph newGlyph;
-	if (cacheGlyph(newGlyph, chr)) {
-		_glyphs[chr] = newGlyph;
-	}
-}
-
 Font *loadTTFFont(Common::SeekableReadStream &stream, int size, TTFSizeMode sizeMode, uint dpi, TTFRenderMode renderMode, const uint32 *mapping, bool stemDarkening) {
 	TTFFont *font = new TTFFont();
 
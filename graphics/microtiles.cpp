@@ -0,0 +1,153 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/microtiles.h"
+#include "common/array.h"
+#include "common/util.h"
+
+namespace Graphics {
+
+MicroTileArray::MicroTileArray() :
+	_tiles(nullptr), _width(0), _height(0), _tileSize(32), _tilesW(0), _tilesH(0), _empty(true) {
+}
+
+MicroTileArray::MicroTileArray(int16 width, int16 height, int tileSize) :
+	_tiles(nullptr), _width(0), _height(0), _tileSize(32), _tilesW(0), _tilesH(0), _empty(true) {
+	init(width, height, tileSize);
+}
+
+MicroTileArray::~MicroTileArray() {
+	delete[] _tiles;
+}
+
+void MicroTileArray::init(int16 width, int16 height, int tileSize) {
+	assert(tileSize > 0 && tileSize <= 256);
+	assert(width >= 0 && height >= 0);
+
+	delete[] _tiles;
+
+	_width = width;
+	_height = height;
+	_tileSize = tileSize;
+	_tilesW = (width + tileSize - 1) / tileSize;
+	_tilesH = (height + tileSize - 1) / tileSize;
+	_tiles = new BoundingBox[MAX(_tilesW * _tilesH, 1)];
+	_empty = false;
+	clear();
+}
+
+void MicroTileArray::clear() {
+	if (_empty)
+		return;
+
+	for (int i = 0; i < _tilesW * _tilesH; ++i)
+		_tiles[i] = kEmptyBox;
+	_empty = true;
+}
+
+void MicroTileArray::addRect(const Common::Rect &r) {
+	Common::Rect bounds = r;
+	bounds.clip(Common::Rect(_width, _height));
+	if (bounds.isEmpty())
+		return;
+
+	const int right = bounds.right - 1;
+	const int bottom = bounds.bottom - 1;
+	const int tileX0 = bounds.left / _tileSize;
+	const int tileY0 = bounds.top / _tileSize;
+	const int tileX1 = right / _tileSize;
+	const int tileY1 = bottom / _tileSize;
+
+	for (int ty = tileY0; ty <= tileY1; ++ty) {
+		const int top = ty * _tileSize;
+		const int y0 = MAX<int>(bounds.top - top, 0);
+		const int y1 = MIN<int>(bottom - top, _tileSize - 1);
+
+		BoundingBox *tile = &_tiles[ty * _tilesW + tileX0];
+		for (int tx = tileX0; tx <= tileX1; ++tx, ++tile) {
+			const int left = tx * _tileSize;
+			const int x0 = MAX<int>(bounds.left - left, 0);
+			const int x1 = MIN<int>(right - left, _tileSize - 1);
+
+			const BoundingBox box = *tile;
+			*tile = makeBox(MIN<int>(boxX0(box), x0), MIN<int>(boxY0(box), y0),
+				MAX<int>(boxX1(box), x1), MAX<int>(boxY1(box), y1));
+		}
+	}
+
+	_empty = false;
+}
+
+void MicroTileArray::getRectangles(Common::List<Common::Rect> &rects) const {
+	if (_empty)
+		return;
+
+	Common::Array<Common::Rect> merged;
+
+	for (int ty = 0; ty < _tilesH; ++ty) {
+		const BoundingBox *row = &_tiles[ty * _tilesW];
+		const int top = ty * _tileSize;
+
+		for (int tx = 0; tx < _tilesW; ++tx) {
+			const BoundingBox box = row[tx];
+			if (box == kEmptyBox)
+				continue;
+
+			// Extend the run over following tiles as long as the box reaches
+			// the right edge of its tile and the next box continues it
+			// with the same vertical extent
+			int lastX = tx;
+			while (lastX + 1 < _tilesW &&
+			       boxX1(row[lastX]) == lastTileX(lastX) &&
+			       row[lastX + 1] != kEmptyBox &&
+			       boxX0(row[lastX + 1]) == 0 &&
+			       boxY0(row[lastX + 1]) == boxY0(box) &&
+			       boxY1(row[lastX + 1]) == boxY1(box)) {
+				++lastX;
+			}
+
+			const Common::Rect rect(tx * _tileSize + boxX0(box), top + boxY0(box),
+				lastX * _tileSize + boxX1(row[lastX]) + 1, top + boxY1(box) + 1);
+
+			// Join it to a rectangle with the same columns ending right above
+			bool joined = false;
+			for (uint i = 0; i < merged.size(); ++i) {
+				Common::Rect &other = merged[i];
+				if (other.bottom == rect.top && other.left == rect.left && other.right == rect.right) {
+					other.bottom = rect.bottom;
+					joined = true;
+					break;
+				}
+			}
+
+			if (!joined)
+				merged.push_back(rect);
+
+			tx = lastX;
+		}
+	}
+
+	for (uint i = 0; i < merged.size(); ++i)
+		rects.push_back(merged[i]);
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,130 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_MICROTILES_H
+#define GRAPHICS_MICROTILES_H
+
+#include "common/scummsys.h"
+#include "common/list.h"
+#include "common/noncopyable.h"
+#include "common/rect.h"
+
+namespace Graphics {
+
+/**
+ * @defgroup graphics_microtiles Micro-tile array
+ * @ingroup graphics
+ *
+ * @brief Dirty-region tracker based on micro-tiles.
+ *
+ * @{
+ */
+
+/**
+ * Tracks the dirty areas of a surface in a grid of fixed-size tiles, each
+ * keeping the bounding box of the pixels touched within it.
+ *
+ * Adding a rectangle costs a fixed amount of work per covered tile, however
+ * many rectangles were added before. The dirty area is read back as a small
+ * set of non-overlapping rectangles, with runs of tiles merged horizontally
+ * and vertically.
+ */
+class MicroTileArray : Common::NonCopyable {
+public:
+	MicroTileArray();
+	MicroTileArray(int16 width, int16 height, int tileSize = 32);
+	~MicroTileArray();
+
+	/**
+	 * Resizes the tracked area and discards any dirty areas.
+	 *
+	 * @param tileSize  Width and height of a tile in pixels, between 1 and 256.
+	 */
+	void init(int16 width, int16 height, int tileSize = 32);
+
+	/**
+	 * Marks the given area as dirty. Parts outside the tracked area are
+	 * ignored.
+	 */
+	void addRect(const Common::Rect &r);
+
+	/**
+	 * Discards all dirty areas.
+	 */
+	void clear();
+
+	/**
+	 * Returns true if no area has been marked dirty since the last clear.
+	 */
+	bool empty() const { return _empty; }
+
+	/**
+	 * Appends non-overlapping rectangles covering all dirty areas to the
+	 * given list.
+	 */
+	void getRectangles(Common::List<Common::Rect> &rects) const;
+
+	int16 getWidth() const { return _width; }
+	int16 getHeight() const { return _height; }
+	int getTileSize() const { return _tileSize; }
+
+private:
+	/**
+	 * The inclusive bounding box within a tile, packed as x0, y0, x1, y1 from
+	 * the most significant byte down.
+	 */
+	typedef uint32 BoundingBox;
+
+	/**
+	 * An inverted box, which acts as the identity when boxes are combined.
+	 */
+	static const BoundingBox kEmptyBox = 0xFFFF0000;
+
+	static byte boxX0(BoundingBox box) { return (box >> 24) & 0xFF; }
+	static byte boxY0(BoundingBox box) { return (box >> 16) & 0xFF; }
+	static byte boxX1(BoundingBox box) { return (box >> 8) & 0xFF; }
+	static byte boxY1(BoundingBox box) { return box & 0xFF; }
+
+	static BoundingBox makeBox(int x0, int y0, int x1, int y1) {
+		return ((uint32)x0 << 24) | ((uint32)y0 << 16) | ((uint32)x1 << 8) | (uint32)y1;
+	}
+
+	/**
+	 * Returns the last pixel column of the given tile column, relative to the
+	 * tile, which is smaller than the tile size for a partial last column.
+	 */
+	int lastTileX(int tileX) const {
+		return MIN<int>(_tileSize, _width - tileX * _tileSize) - 1;
+	}
+
+	BoundingBox *_tiles;
+	int16 _width, _height;
+	int _tileSize;
+	int _tilesW, _tilesH;
+	bool _empty;
+};
+
+/** @} */
+
+} // End of namespace Graphics
+
+#endif
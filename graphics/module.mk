@@ -15,6 +15,7 @@ MODULE_OBJS := \
 	korfont.o \
 	larryScale.o \
 	maccursor.o \
+	microtiles.o \
 	macgui/datafiles.o \
 	macgui/macbutton.o \
 	macgui/macfontmanager.o \
@@ -100,7 +101,8 @@ endif
 ifdef USE_HQ_SCALERS
 MODULE_OBJS += \
 	scaler/hq2x.o \
-	scaler/hq3x.o
+	scaler/hq3x.o \
+	scaler/hqx.o
 
 ifdef USE_NASM
 MODULE_OBJS += \
@@ -20,8 +20,14 @@
  *
  */
 
+#include "graphics/scaler.h"
 #include "graphics/scaler/intern.h"
 #include "graphics/scaler/scalebit.h"
+#include "graphics/scaler/scale2x.h"
+#include "graphics/scaler/scale3x.h"
+#ifdef USE_HQ_SCALERS
+#include "graphics/scaler/hqx.h"
+#endif
 #include "common/util.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -341,3 +347,241 @@ void DotMatrix(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPi
 }
 
 #endif // #ifdef USE_SCALERS
+
+#ifdef USE_SCALERS
+/*
+ * AdvMame2x and AdvMame3x using the SIMD Scale2x and Scale3x row kernels.
+ * They are only used after checking the CPU supports the instruction set,
+ * see selectScalerImplementation.
+ */
+#ifdef SCALE2X_AVX2
+static void AdvMame2xAVX2(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+							 int width, int height) {
+	while (height--) {
+		scale2x_16_avx2((uint16 *)dstPtr, (uint16 *)(dstPtr + dstPitch),
+			(const uint16 *)(srcPtr - srcPitch), (const uint16 *)srcPtr, (const uint16 *)(srcPtr + srcPitch), width);
+		srcPtr += srcPitch;
+		dstPtr += dstPitch << 1;
+	}
+}
+#endif
+
+#ifdef SCALE2X_SSE2
+static void AdvMame2xSSE2(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+							 int width, int height) {
+	while (height--) {
+		scale2x_16_sse2((uint16 *)dstPtr, (uint16 *)(dstPtr + dstPitch),
+			(const uint16 *)(srcPtr - srcPitch), (const uint16 *)srcPtr, (const uint16 *)(srcPtr + srcPitch), width);
+		srcPtr += srcPitch;
+		dstPtr += dstPitch << 1;
+	}
+}
+#endif
+
+#ifdef SCALE2X_NEON
+static void AdvMame2xNEON(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+							 int width, int height) {
+	while (height--) {
+		scale2x_16_neon((uint16 *)dstPtr, (uint16 *)(dstPtr + dstPitch),
+			(const uint16 *)(srcPtr - srcPitch), (const uint16 *)srcPtr, (const uint16 *)(srcPtr + srcPitch), width);
+		srcPtr += srcPitch;
+		dstPtr += dstPitch << 1;
+	}
+}
+#endif
+
+#ifdef SCALE3X_SSE2
+static void AdvMame3xSSE2(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+							 int width, int height) {
+	while (height--) {
+		scale3x_16_sse2((uint16 *)dstPtr, (uint16 *)(dstPtr + dstPitch), (uint16 *)(dstPtr + 2 * dstPitch),
+			(const uint16 *)(srcPtr - srcPitch), (const uint16 *)srcPtr, (const uint16 *)(srcPtr + srcPitch), width);
+		srcPtr += srcPitch;
+		dstPtr += 3 * dstPitch;
+	}
+}
+#endif
+
+#ifdef SCALE3X_NEON
+static void AdvMame3xNEON(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch,
+							 int width, int height) {
+	while (height--) {
+		scale3x_16_neon((uint16 *)dstPtr, (uint16 *)(dstPtr + dstPitch), (uint16 *)(dstPtr + 2 * dstPitch),
+			(const uint16 *)(srcPtr - srcPitch), (const uint16 *)srcPtr, (const uint16 *)(srcPtr + srcPitch), width);
+		srcPtr += srcPitch;
+		dstPtr += 3 * dstPitch;
+	}
+}
+#endif
+#endif // #ifdef USE_SCALERS
+
+uint32 getScalerCPUFeatures() {
+	static uint32 features = 0;
+	static bool detected = false;
+
+	if (detected)
+		return features;
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("mmx"))
+		features |= kScalerCPUFeatureMMX;
+	if (__builtin_cpu_supports("sse2"))
+		features |= kScalerCPUFeatureSSE2;
+	if (__builtin_cpu_supports("avx2"))
+		features |= kScalerCPUFeatureAVX2;
+#elif defined(__SSE2__)
+	features |= kScalerCPUFeatureMMX | kScalerCPUFeatureSSE2;
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+	features |= kScalerCPUFeatureNEON;
+#endif
+
+	detected = true;
+	return features;
+}
+
+#if defined(USE_HQ_SCALERS) && defined(USE_NASM)
+// The i386 assembly HQ scalers keep their state in global variables
+#define HQ_SCALERS_THREADSAFE false
+#else
+#define HQ_SCALERS_THREADSAFE true
+#endif
+
+static const ScalerImplementation s_normal1xImpl[] = {
+	{ Normal1x, 0, true },
+	{ nullptr, 0, false }
+};
+
+#ifdef USE_SCALERS
+static const ScalerImplementation s_normal2xImpl[] = {
+	{ Normal2x, 0, true },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_normal3xImpl[] = {
+	{ Normal3x, 0, true },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_2xSaIImpl[] = {
+	{ _2xSaI, 0, true },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_super2xSaIImpl[] = {
+	{ Super2xSaI, 0, true },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_superEagleImpl[] = {
+	{ SuperEagle, 0, true },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_advMame2xImpl[] = {
+#ifdef SCALE2X_AVX2
+	{ AdvMame2xAVX2, kScalerCPUFeatureAVX2, true },
+#endif
+#ifdef SCALE2X_SSE2
+	{ AdvMame2xSSE2, kScalerCPUFeatureSSE2, true },
+#endif
+#ifdef SCALE2X_NEON
+	{ AdvMame2xNEON, kScalerCPUFeatureNEON, true },
+#endif
+	{ AdvMame2x, 0, true },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_advMame3xImpl[] = {
+#ifdef SCALE3X_SSE2
+	{ AdvMame3xSSE2, kScalerCPUFeatureSSE2, true },
+#endif
+#ifdef SCALE3X_NEON
+	{ AdvMame3xNEON, kScalerCPUFeatureNEON, true },
+#endif
+	{ AdvMame3x, 0, true },
+	{ nullptr, 0, false }
+};
+
+#ifdef USE_HQ_SCALERS
+static const ScalerImplementation s_hq2xImpl[] = {
+#ifdef HQX_SSE2
+	{ HQ2xSSE2, kScalerCPUFeatureSSE2, true },
+#endif
+#ifdef HQX_NEON
+	{ HQ2xNEON, kScalerCPUFeatureNEON, true },
+#endif
+	{ HQ2x, 0, HQ_SCALERS_THREADSAFE },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_hq3xImpl[] = {
+#ifdef HQX_SSE2
+	{ HQ3xSSE2, kScalerCPUFeatureSSE2, true },
+#endif
+#ifdef HQX_NEON
+	{ HQ3xNEON, kScalerCPUFeatureNEON, true },
+#endif
+	{ HQ3x, 0, HQ_SCALERS_THREADSAFE },
+	{ nullptr, 0, false }
+};
+#endif
+
+static const ScalerImplementation s_tv2xImpl[] = {
+	{ TV2x, 0, true },
+	{ nullptr, 0, false }
+};
+
+static const ScalerImplementation s_dotMatrixImpl[] = {
+	{ DotMatrix, 0, true },
+	{ nullptr, 0, false }
+};
+#endif // #ifdef USE_SCALERS
+
+static const ScalerDescriptor s_scalers[] = {
+	{ "1x", 1, 1 << 2, s_normal1xImpl },
+#ifdef USE_SCALERS
+	{ "2x", 2, 1 << 2, s_normal2xImpl },
+	{ "3x", 3, 1 << 2, s_normal3xImpl },
+	{ "2xsai", 2, 1 << 2, s_2xSaIImpl },
+	{ "super2xsai", 2, 1 << 2, s_super2xSaIImpl },
+	{ "supereagle", 2, 1 << 2, s_superEagleImpl },
+	{ "advmame2x", 2, 1 << 2, s_advMame2xImpl },
+	{ "advmame3x", 3, 1 << 2, s_advMame3xImpl },
+#ifdef USE_HQ_SCALERS
+	{ "hq2x", 2, 1 << 2, s_hq2xImpl },
+	{ "hq3x", 3, 1 << 2, s_hq3xImpl },
+#endif
+	{ "tv2x", 2, 1 << 2, s_tv2xImpl },
+	{ "dotmatrix", 2, 1 << 2, s_dotMatrixImpl },
+#endif
+	{ nullptr, 0, 0, nullptr }
+};
+
+const ScalerDescriptor *getScalerDescriptors() {
+	return s_scalers;
+}
+
+const ScalerDescriptor *findScalerDescriptor(const char *name) {
+	for (const ScalerDescriptor *desc = s_scalers; desc->name; ++desc) {
+		if (!scumm_stricmp(desc->name, name))
+			return desc;
+	}
+
+	return nullptr;
+}
+
+const ScalerImplementation *selectScalerImplementation(const ScalerDescriptor *desc, int bytesPerPixel) {
+	if (!desc || !(desc->bytesPerPixelMask & (1 << bytesPerPixel)))
+		return nullptr;
+
+	const uint32 features = getScalerCPUFeatures();
+	for (const ScalerImplementation *impl = desc->implementations; impl->proc; ++impl) {
+		if ((impl->cpuFeatures & features) == impl->cpuFeatures)
+			return impl;
+	}
+
+	return nullptr;
+}
@@ -61,6 +61,56 @@ DECLARE_SCALER(HQ3x);
 
 #endif // #ifdef USE_SCALERS
 
+/** CPU features which scaler implementations may depend on. */
+enum ScalerCPUFeature {
+	kScalerCPUFeatureMMX  = 1 << 0,
+	kScalerCPUFeatureSSE2 = 1 << 1,
+	kScalerCPUFeatureAVX2 = 1 << 2,
+	kScalerCPUFeatureNEON = 1 << 3
+};
+
+/**
+ * Returns the ScalerCPUFeature flags supported by the CPU we are running on.
+ * On x86 this is detected at runtime, elsewhere it reflects the features
+ * the binary was compiled for.
+ */
+extern uint32 getScalerCPUFeatures();
+
+/** A single implementation of a scaler. */
+struct ScalerImplementation {
+	ScalerProc *proc;
+	/** ScalerCPUFeature flags which all need to be supported to use proc. */
+	uint32 cpuFeatures;
+	/** Whether proc may be run concurrently on different parts of the screen. */
+	bool threadSafe;
+};
+
+/** Description of a scaler and of its available implementations. */
+struct ScalerDescriptor {
+	/** Name of the scaler, matching the graphics mode names. */
+	const char *name;
+	int factor;
+	/** Bit mask of the supported bytes per pixel, (1 << 2) for 16bpp. */
+	uint32 bytesPerPixelMask;
+	/** Implementations ordered from fastest to slowest, terminated by a null proc. */
+	const ScalerImplementation *implementations;
+};
+
+/**
+ * Returns the table of all available scalers, terminated by an entry
+ * without name.
+ */
+extern const ScalerDescriptor *getScalerDescriptors();
+
+/** Looks up a scaler by name, returns nullptr when there is none. */
+extern const ScalerDescriptor *findScalerDescriptor(const char *name);
+
+/**
+ * Picks the fastest implementation of a scaler which is supported by the
+ * current CPU and handles the given number of bytes per pixel.
+ */
+extern const ScalerImplementation *selectScalerImplementation(const ScalerDescriptor *desc, int bytesPerPixel = 2);
+
 // creates a 160x100 thumbnail for 320x200 games
 // and 160x120 thumbnail for 320x240 and 640x480 games
 // only 565 mode
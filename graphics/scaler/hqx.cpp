@@ -0,0 +1,185 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/scaler/hqx.h"
+#include "graphics/scaler/intern.h"
+
+#ifdef HQX_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef HQX_NEON
+#include <arm_neon.h>
+#endif
+
+void hqxPatterns_def(uint8 *patterns, const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, int width) {
+	for (int i = 0; i < width; ++i) {
+		const uint32 yuv5 = yuv1[i];
+
+		int pattern = 0;
+		if (yuv5 != yuv0[i - 1] && diffYUV(yuv5, yuv0[i - 1])) pattern |= 0x0001;
+		if (yuv5 != yuv0[i]     && diffYUV(yuv5, yuv0[i]))     pattern |= 0x0002;
+		if (yuv5 != yuv0[i + 1] && diffYUV(yuv5, yuv0[i + 1])) pattern |= 0x0004;
+		if (yuv5 != yuv1[i - 1] && diffYUV(yuv5, yuv1[i - 1])) pattern |= 0x0008;
+		if (yuv5 != yuv1[i + 1] && diffYUV(yuv5, yuv1[i + 1])) pattern |= 0x0010;
+		if (yuv5 != yuv2[i - 1] && diffYUV(yuv5, yuv2[i - 1])) pattern |= 0x0020;
+		if (yuv5 != yuv2[i]     && diffYUV(yuv5, yuv2[i]))     pattern |= 0x0040;
+		if (yuv5 != yuv2[i + 1] && diffYUV(yuv5, yuv2[i + 1])) pattern |= 0x0080;
+		patterns[i] = pattern;
+	}
+}
+
+/*
+ * The SIMD versions compare four YUV values at once. Y, U and V each fit
+ * in a byte, so the absolute difference of each component is a saturated
+ * byte subtraction in both directions, and a component exceeds its
+ * threshold if subtracting the threshold leaves something behind.
+ */
+
+// Thresholds of diffYUV() for Y, U and V, in the YUV byte layout
+#define HQX_YUV_THRESHOLDS 0x00300706
+
+#ifdef HQX_SSE2
+
+__attribute__((target("sse2")))
+static inline __m128i hqxDiff_sse2(__m128i yuv5, const uint32 *yuv, __m128i threshold, int bit) {
+	const __m128i other = _mm_loadu_si128((const __m128i *)yuv);
+	const __m128i diff = _mm_or_si128(_mm_subs_epu8(yuv5, other), _mm_subs_epu8(other, yuv5));
+	const __m128i same = _mm_cmpeq_epi32(_mm_subs_epu8(diff, threshold), _mm_setzero_si128());
+	return _mm_andnot_si128(same, _mm_set1_epi32(bit));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i hqxPattern4_sse2(const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, __m128i threshold) {
+	const __m128i yuv5 = _mm_loadu_si128((const __m128i *)yuv1);
+
+	__m128i pattern = hqxDiff_sse2(yuv5, yuv0 - 1, threshold, 0x0001);
+	pattern = _mm_or_si128(pattern, hqxDiff_sse2(yuv5, yuv0, threshold, 0x0002));
+	pattern = _mm_or_si128(pattern, hqxDiff_sse2(yuv5, yuv0 + 1, threshold, 0x0004));
+	pattern = _mm_or_si128(pattern, hqxDiff_sse2(yuv5, yuv1 - 1, threshold, 0x0008));
+	pattern = _mm_or_si128(pattern, hqxDiff_sse2(yuv5, yuv1 + 1, threshold, 0x0010));
+	pattern = _mm_or_si128(pattern, hqxDiff_sse2(yuv5, yuv2 - 1, threshold, 0x0020));
+	pattern = _mm_or_si128(pattern, hqxDiff_sse2(yuv5, yuv2, threshold, 0x0040));
+	pattern = _mm_or_si128(pattern, hqxDiff_sse2(yuv5, yuv2 + 1, threshold, 0x0080));
+	return pattern;
+}
+
+/**
+ * Compute the neighbour patterns of a row like hqxPatterns_def(), eight
+ * pixels at a time using SSE2 instructions. The code is compiled for SSE2
+ * regardless of the compiler flags, so the caller needs to make sure the
+ * CPU supports it.
+ */
+__attribute__((target("sse2")))
+void hqxPatterns_sse2(uint8 *patterns, const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, int width) {
+	const __m128i threshold = _mm_set1_epi32(HQX_YUV_THRESHOLDS);
+
+	int i = 0;
+	for (; i + 8 <= width; i += 8) {
+		const __m128i lo = hqxPattern4_sse2(yuv0 + i, yuv1 + i, yuv2 + i, threshold);
+		const __m128i hi = hqxPattern4_sse2(yuv0 + i + 4, yuv1 + i + 4, yuv2 + i + 4, threshold);
+		const __m128i packed = _mm_packs_epi32(lo, hi);
+		_mm_storel_epi64((__m128i *)(patterns + i), _mm_packus_epi16(packed, packed));
+	}
+
+	if (i < width)
+		hqxPatterns_def(patterns + i, yuv0 + i, yuv1 + i, yuv2 + i, width - i);
+}
+
+#endif
+
+#ifdef HQX_NEON
+
+static inline uint32x4_t hqxDiff_neon(uint8x16_t yuv5, const uint32 *yuv, uint8x16_t threshold, uint32 bit) {
+	const uint8x16_t diff = vabdq_u8(yuv5, vreinterpretq_u8_u32(vld1q_u32(yuv)));
+	const uint32x4_t over = vreinterpretq_u32_u8(vqsubq_u8(diff, threshold));
+	return vandq_u32(vtstq_u32(over, over), vdupq_n_u32(bit));
+}
+
+static inline uint16x4_t hqxPattern4_neon(const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, uint8x16_t threshold) {
+	const uint8x16_t yuv5 = vreinterpretq_u8_u32(vld1q_u32(yuv1));
+
+	uint32x4_t pattern = hqxDiff_neon(yuv5, yuv0 - 1, threshold, 0x0001);
+	pattern = vorrq_u32(pattern, hqxDiff_neon(yuv5, yuv0, threshold, 0x0002));
+	pattern = vorrq_u32(pattern, hqxDiff_neon(yuv5, yuv0 + 1, threshold, 0x0004));
+	pattern = vorrq_u32(pattern, hqxDiff_neon(yuv5, yuv1 - 1, threshold, 0x0008));
+	pattern = vorrq_u32(pattern, hqxDiff_neon(yuv5, yuv1 + 1, threshold, 0x0010));
+	pattern = vorrq_u32(pattern, hqxDiff_neon(yuv5, yuv2 - 1, threshold, 0x0020));
+	pattern = vorrq_u32(pattern, hqxDiff_neon(yuv5, yuv2, threshold, 0x0040));
+	pattern = vorrq_u32(pattern, hqxDiff_neon(yuv5, yuv2 + 1, threshold, 0x0080));
+	return vmovn_u32(pattern);
+}
+
+/**
+ * Compute the neighbour patterns of a row like hqxPatterns_def(), eight
+ * pixels at a time using NEON instructions.
+ */
+void hqxPatterns_neon(uint8 *patterns, const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, int width) {
+	const uint8x16_t threshold = vreinterpretq_u8_u32(vdupq_n_u32(HQX_YUV_THRESHOLDS));
+
+	int i = 0;
+	for (; i + 8 <= width; i += 8) {
+		const uint16x4_t lo = hqxPattern4_neon(yuv0 + i, yuv1 + i, yuv2 + i, threshold);
+		const uint16x4_t hi = hqxPattern4_neon(yuv0 + i + 4, yuv1 + i + 4, yuv2 + i + 4, threshold);
+		vst1_u8(patterns + i, vmovn_u16(vcombine_u16(lo, hi)));
+	}
+
+	if (i < width)
+		hqxPatterns_def(patterns + i, yuv0 + i, yuv1 + i, yuv2 + i, width - i);
+}
+
+#endif
+
+HQxRowPatterns::HQxRowPatterns(int width, HQxPatternProc *proc) : _width(width), _proc(proc), _first(true) {
+	// Each row also holds the pixels left and right of the scaled area
+	for (int i = 0; i < 3; ++i)
+		_yuv[i] = (uint32 *)malloc((width + 2) * sizeof(uint32)) + 1;
+	_patterns = (uint8 *)malloc(width);
+}
+
+HQxRowPatterns::~HQxRowPatterns() {
+	for (int i = 0; i < 3; ++i)
+		free(_yuv[i] - 1);
+	free(_patterns);
+}
+
+void HQxRowPatterns::convertRow(uint32 *yuv, const uint16 *row) {
+	for (int i = -1; i <= _width; ++i)
+		yuv[i] = RGBtoYUV[row[i]];
+}
+
+const uint8 *HQxRowPatterns::next(const uint16 *row, uint32 nextlineSrc) {
+	if (_first) {
+		convertRow(_yuv[0], row - nextlineSrc);
+		convertRow(_yuv[1], row);
+		_first = false;
+	} else {
+		uint32 *oldest = _yuv[0];
+		_yuv[0] = _yuv[1];
+		_yuv[1] = _yuv[2];
+		_yuv[2] = oldest;
+	}
+	convertRow(_yuv[2], row + nextlineSrc);
+
+	_proc(_patterns, _yuv[0], _yuv[1], _yuv[2], _width);
+	return _patterns;
+}
@@ -0,0 +1,114 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_SCALER_HQX_H
+#define GRAPHICS_SCALER_HQX_H
+
+#include "common/scummsys.h"
+
+/*
+ * The SSE2 code is always built on x86 compilers supporting the target
+ * attribute, and must be selected at runtime after checking the CPU.
+ */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && (defined(__clang__) || __GNUC__ >= 5)
+#define HQX_SSE2
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define HQX_NEON
+#endif
+
+#if defined(USE_NASM) && !defined(_WIN32) && !defined(MACOSX) && !defined(__OS2__)
+#define RGBtoYUV _RGBtoYUV
+#endif
+
+/** RGB to YUV lookup table of the HQ scalers, set up by InitScalers(). */
+extern "C" uint32 *RGBtoYUV;
+
+/**
+ * Compute the HQx neighbour patterns of a row of pixels.
+ *
+ * Bit n of a pattern is set if the YUV value of the n-th neighbour, counted
+ * row by row and skipping the pixel itself, differs noticeably from the
+ * YUV value of the pixel.
+ *
+ * @param patterns  Receives one pattern per pixel.
+ * @param yuv0      YUV values of the previous row.
+ * @param yuv1      YUV values of the current row.
+ * @param yuv2      YUV values of the next row.
+ * @param width     Number of pixels in the row. The YUV rows must also
+ *                  contain the pixels at index -1 and width.
+ */
+typedef void HQxPatternProc(uint8 *patterns, const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, int width);
+
+void hqxPatterns_def(uint8 *patterns, const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, int width);
+
+#ifdef HQX_SSE2
+void hqxPatterns_sse2(uint8 *patterns, const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, int width);
+#endif
+
+#ifdef HQX_NEON
+void hqxPatterns_neon(uint8 *patterns, const uint32 *yuv0, const uint32 *yuv1, const uint32 *yuv2, int width);
+#endif
+
+/**
+ * Provides the neighbour patterns of the rows of a 16bpp surface, keeping
+ * the YUV values of the three rows involved so each source pixel is only
+ * converted once.
+ */
+class HQxRowPatterns {
+public:
+	HQxRowPatterns(int width, HQxPatternProc *proc);
+	~HQxRowPatterns();
+
+	/**
+	 * Return the patterns of the row starting at @p row. Every call after
+	 * the first one must pass the row following the previous one.
+	 */
+	const uint8 *next(const uint16 *row, uint32 nextlineSrc);
+
+private:
+	void convertRow(uint32 *yuv, const uint16 *row);
+
+	int _width;
+	HQxPatternProc *_proc;
+	uint32 *_yuv[3];
+	uint8 *_patterns;
+	bool _first;
+};
+
+/*
+ * Variants of the C++ HQ2x and HQ3x scalers computing the neighbour patterns
+ * with SIMD instructions. They are also used on builds with the NASM
+ * scalers, as they are safe to run on several parts of the screen at once.
+ */
+#ifdef HQX_SSE2
+void HQ2xSSE2(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height);
+void HQ3xSSE2(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height);
+#endif
+
+#ifdef HQX_NEON
+void HQ2xNEON(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height);
+void HQ3xNEON(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height);
+#endif
+
+#endif
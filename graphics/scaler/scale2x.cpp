@@ -19,7 +19,7 @@
  */
 
 /*
- * This file contains a C and MMX implementation of the Scale2x effect.
+ * This file contains a C, MMX, SSE2, AVX2 and NEON implementation of the Scale2x effect.
  *
  * You can find an high level description of the effect at :
  *
@@ -36,6 +36,14 @@
 
 #include "graphics/scaler/scale2x.h"
 
+#if defined(SCALE2X_SSE2) || defined(SCALE2X_AVX2)
+#include <immintrin.h>
+#endif
+
+#if defined(SCALE2X_NEON)
+#include <arm_neon.h>
+#endif
+
 /***************************************************************************/
 /* Scale2x C implementation */
 
@@ -500,3 +508,186 @@ void scale2x_32_mmx(scale2x_uint32* dst0, scale2x_uint32* dst1, const scale2x_ui
 }
 
 #endif
+
+/***************************************************************************/
+/* Scale2x SSE2 implementation */
+
+#if defined(SCALE2X_SSE2)
+
+/**
+ * Apply the Scale2x effect at a single row of 16 bits pixels.
+ * Eight source pixels are processed per iteration with the same
+ * cmp/and/not trick used by the MMX version, the remaining pixels
+ * are handled by the C implementation.
+ */
+__attribute__((target("sse2")))
+static inline void scale2x_16_sse2_single(scale2x_uint16* __restrict__ dst, const scale2x_uint16* __restrict__ src0, const scale2x_uint16* __restrict__ src1, const scale2x_uint16* __restrict__ src2, unsigned count) {
+	while (count >= 8) {
+		__m128i b = _mm_loadu_si128((const __m128i *)src0);
+		__m128i h = _mm_loadu_si128((const __m128i *)src2);
+		__m128i d = _mm_loadu_si128((const __m128i *)(src1 - 1));
+		__m128i e = _mm_loadu_si128((const __m128i *)src1);
+		__m128i f = _mm_loadu_si128((const __m128i *)(src1 + 1));
+
+		/* B != H && D != F */
+		__m128i cond = _mm_or_si128(_mm_cmpeq_epi16(b, h), _mm_cmpeq_epi16(d, f));
+		__m128i m0 = _mm_andnot_si128(cond, _mm_cmpeq_epi16(d, b));
+		__m128i m1 = _mm_andnot_si128(cond, _mm_cmpeq_epi16(f, b));
+
+		__m128i p0 = _mm_or_si128(_mm_and_si128(m0, b), _mm_andnot_si128(m0, e));
+		__m128i p1 = _mm_or_si128(_mm_and_si128(m1, b), _mm_andnot_si128(m1, e));
+
+		_mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi16(p0, p1));
+		_mm_storeu_si128((__m128i *)(dst + 8), _mm_unpackhi_epi16(p0, p1));
+
+		src0 += 8;
+		src1 += 8;
+		src2 += 8;
+		dst += 16;
+		count -= 8;
+	}
+
+	if (count)
+		scale2x_16_def_single(dst, src0, src1, src2, count);
+}
+
+/**
+ * Scale by a factor of 2 a row of pixels of 16 bits.
+ * This function operates like scale2x_16_def() but uses SSE2 instructions.
+ * It has no restriction on the row length. Before calling this function you
+ * must ensure that the current CPU supports the SSE2 instruction set.
+ * @param src0 Pointer at the first pixel of the previous row.
+ * @param src1 Pointer at the first pixel of the current row.
+ * @param src2 Pointer at the first pixel of the next row.
+ * @param count Length in pixels of the src0, src1 and src2 rows.
+ * @param dst0 First destination row, double length in pixels.
+ * @param dst1 Second destination row, double length in pixels.
+ */
+__attribute__((target("sse2")))
+void scale2x_16_sse2(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_uint16* src0, const scale2x_uint16* src1, const scale2x_uint16* src2, unsigned count) {
+	scale2x_16_sse2_single(dst0, src0, src1, src2, count);
+	scale2x_16_sse2_single(dst1, src2, src1, src0, count);
+}
+
+#endif
+
+/***************************************************************************/
+/* Scale2x NEON implementation */
+
+#if defined(SCALE2X_NEON)
+
+/**
+ * Apply the Scale2x effect at a single row of 16 bits pixels.
+ * Eight source pixels are processed per iteration, the two output
+ * pixels of each source pixel are interleaved by the store itself.
+ */
+static inline void scale2x_16_neon_single(scale2x_uint16* __restrict__ dst, const scale2x_uint16* __restrict__ src0, const scale2x_uint16* __restrict__ src1, const scale2x_uint16* __restrict__ src2, unsigned count) {
+	while (count >= 8) {
+		uint16x8_t b = vld1q_u16(src0);
+		uint16x8_t h = vld1q_u16(src2);
+		uint16x8_t d = vld1q_u16(src1 - 1);
+		uint16x8_t e = vld1q_u16(src1);
+		uint16x8_t f = vld1q_u16(src1 + 1);
+
+		/* B != H && D != F */
+		uint16x8_t cond = vorrq_u16(vceqq_u16(b, h), vceqq_u16(d, f));
+		uint16x8_t m0 = vbicq_u16(vceqq_u16(d, b), cond);
+		uint16x8_t m1 = vbicq_u16(vceqq_u16(f, b), cond);
+
+		uint16x8x2_t p;
+		p.val[0] = vbslq_u16(m0, b, e);
+		p.val[1] = vbslq_u16(m1, b, e);
+		vst2q_u16(dst, p);
+
+		src0 += 8;
+		src1 += 8;
+		src2 += 8;
+		dst += 16;
+		count -= 8;
+	}
+
+	if (count)
+		scale2x_16_def_single(dst, src0, src1, src2, count);
+}
+
+/**
+ * Scale by a factor of 2 a row of pixels of 16 bits.
+ * This function operates like scale2x_16_def() but uses NEON instructions.
+ * It has no restriction on the row length.
+ * @param src0 Pointer at the first pixel of the previous row.
+ * @param src1 Pointer at the first pixel of the current row.
+ * @param src2 Pointer at the first pixel of the next row.
+ * @param count Length in pixels of the src0, src1 and src2 rows.
+ * @param dst0 First destination row, double length in pixels.
+ * @param dst1 Second destination row, double length in pixels.
+ */
+void scale2x_16_neon(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_uint16* src0, const scale2x_uint16* src1, const scale2x_uint16* src2, unsigned count) {
+	scale2x_16_neon_single(dst0, src0, src1, src2, count);
+	scale2x_16_neon_single(dst1, src2, src1, src0, count);
+}
+
+#endif
+
+/***************************************************************************/
+/* Scale2x AVX2 implementation */
+
+#if defined(SCALE2X_AVX2)
+
+/**
+ * Apply the Scale2x effect at a single row of 16 bits pixels.
+ * This is the SSE2 algorithm widened to sixteen source pixels per
+ * iteration. The code is compiled for AVX2 regardless of the compiler
+ * flags, so it must only be called after checking the CPU supports it.
+ */
+__attribute__((target("avx2")))
+static void scale2x_16_avx2_single(scale2x_uint16* __restrict__ dst, const scale2x_uint16* __restrict__ src0, const scale2x_uint16* __restrict__ src1, const scale2x_uint16* __restrict__ src2, unsigned count) {
+	while (count >= 16) {
+		__m256i b = _mm256_loadu_si256((const __m256i *)src0);
+		__m256i h = _mm256_loadu_si256((const __m256i *)src2);
+		__m256i d = _mm256_loadu_si256((const __m256i *)(src1 - 1));
+		__m256i e = _mm256_loadu_si256((const __m256i *)src1);
+		__m256i f = _mm256_loadu_si256((const __m256i *)(src1 + 1));
+
+		/* B != H && D != F */
+		__m256i cond = _mm256_or_si256(_mm256_cmpeq_epi16(b, h), _mm256_cmpeq_epi16(d, f));
+		__m256i m0 = _mm256_andnot_si256(cond, _mm256_cmpeq_epi16(d, b));
+		__m256i m1 = _mm256_andnot_si256(cond, _mm256_cmpeq_epi16(f, b));
+
+		__m256i p0 = _mm256_blendv_epi8(e, b, m0);
+		__m256i p1 = _mm256_blendv_epi8(e, b, m1);
+
+		/* the unpack instructions work on each 128 bits lane separately */
+		__m256i lo = _mm256_unpacklo_epi16(p0, p1);
+		__m256i hi = _mm256_unpackhi_epi16(p0, p1);
+		_mm256_storeu_si256((__m256i *)dst, _mm256_permute2x128_si256(lo, hi, 0x20));
+		_mm256_storeu_si256((__m256i *)(dst + 16), _mm256_permute2x128_si256(lo, hi, 0x31));
+
+		src0 += 16;
+		src1 += 16;
+		src2 += 16;
+		dst += 32;
+		count -= 16;
+	}
+
+	if (count)
+		scale2x_16_def_single(dst, src0, src1, src2, count);
+}
+
+/**
+ * Scale by a factor of 2 a row of pixels of 16 bits.
+ * This function operates like scale2x_16_def() but uses AVX2 instructions.
+ * Before calling this function you must ensure that the current CPU supports
+ * the AVX2 instruction set.
+ * @param src0 Pointer at the first pixel of the previous row.
+ * @param src1 Pointer at the first pixel of the current row.
+ * @param src2 Pointer at the first pixel of the next row.
+ * @param count Length in pixels of the src0, src1 and src2 rows.
+ * @param dst0 First destination row, double length in pixels.
+ * @param dst1 Second destination row, double length in pixels.
+ */
+void scale2x_16_avx2(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_uint16* src0, const scale2x_uint16* src1, const scale2x_uint16* src2, unsigned count) {
+	scale2x_16_avx2_single(dst0, src0, src1, src2, count);
+	scale2x_16_avx2_single(dst1, src2, src1, src0, count);
+}
+
+#endif
@@ -57,6 +57,28 @@ static inline void scale2x_mmx_emms(void)
 
 #endif
 
+/*
+ * The SSE2 and AVX2 code is always built on x86 compilers supporting the
+ * target attribute, and must be selected at runtime after checking the CPU.
+ */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && (defined(__clang__) || __GNUC__ >= 5)
+
+#define SCALE2X_SSE2
+#define SCALE2X_AVX2
+
+void scale2x_16_sse2(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_uint16* src0, const scale2x_uint16* src1, const scale2x_uint16* src2, unsigned count);
+void scale2x_16_avx2(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_uint16* src0, const scale2x_uint16* src1, const scale2x_uint16* src2, unsigned count);
+
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+#define SCALE2X_NEON
+
+void scale2x_16_neon(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_uint16* src0, const scale2x_uint16* src1, const scale2x_uint16* src2, unsigned count);
+
+#endif
+
 #if defined(USE_ARM_SCALER_ASM)
 
 extern "C" void scale2x_8_arm(scale2x_uint8* dst0, scale2x_uint8* dst1, const scale2x_uint8* src0, const scale2x_uint8* src1, const scale2x_uint8* src2, unsigned count);
@@ -19,7 +19,7 @@
  */
 
 /*
- * This file contains a C and MMX implementation of the Scale2x effect.
+ * This file contains a C, SSE2 and NEON implementation of the Scale3x effect.
  *
  * You can find an high level description of the effect at :
  *
@@ -36,6 +36,14 @@
 
 #include "graphics/scaler/scale3x.h"
 
+#if defined(SCALE3X_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(SCALE3X_NEON)
+#include <arm_neon.h>
+#endif
+
 /***************************************************************************/
 /* Scale3x C implementation */
 
@@ -220,3 +228,213 @@ void scale3x_32_def(scale3x_uint32* dst0, scale3x_uint32* dst1, scale3x_uint32*
 	scale3x_32_def_center(dst1, src0, src1, src2, count);
 	scale3x_32_def_border(dst2, src2, src1, src0, count);
 }
+
+/***************************************************************************/
+/* Scale3x SSE2 implementation */
+
+#if defined(SCALE3X_SSE2)
+
+__attribute__((target("sse2")))
+static inline __m128i scale3x_sse2_select(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+__attribute__((target("sse2")))
+static inline void scale3x_16_sse2_store(scale3x_uint16* __restrict__ dst, __m128i p0, __m128i p1, __m128i p2) {
+	scale3x_uint16 tmp[3][8];
+
+	_mm_storeu_si128((__m128i *)tmp[0], p0);
+	_mm_storeu_si128((__m128i *)tmp[1], p1);
+	_mm_storeu_si128((__m128i *)tmp[2], p2);
+
+	for (unsigned i = 0; i < 8; ++i) {
+		dst[0] = tmp[0][i];
+		dst[1] = tmp[1][i];
+		dst[2] = tmp[2][i];
+		dst += 3;
+	}
+}
+
+__attribute__((target("sse2")))
+static inline void scale3x_16_sse2_border(scale3x_uint16* __restrict__ dst, const scale3x_uint16* __restrict__ src0, const scale3x_uint16* __restrict__ src1, const scale3x_uint16* __restrict__ src2, unsigned count) {
+	while (count >= 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)(src0 - 1));
+		__m128i b = _mm_loadu_si128((const __m128i *)src0);
+		__m128i c = _mm_loadu_si128((const __m128i *)(src0 + 1));
+		__m128i d = _mm_loadu_si128((const __m128i *)(src1 - 1));
+		__m128i e = _mm_loadu_si128((const __m128i *)src1);
+		__m128i f = _mm_loadu_si128((const __m128i *)(src1 + 1));
+		__m128i h = _mm_loadu_si128((const __m128i *)src2);
+
+		/* B != H && D != F */
+		__m128i cond = _mm_or_si128(_mm_cmpeq_epi16(b, h), _mm_cmpeq_epi16(d, f));
+		__m128i db = _mm_andnot_si128(cond, _mm_cmpeq_epi16(d, b));
+		__m128i fb = _mm_andnot_si128(cond, _mm_cmpeq_epi16(f, b));
+		/* (D == B && E != C) || (F == B && E != A) */
+		__m128i m1 = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi16(e, c), db), _mm_andnot_si128(_mm_cmpeq_epi16(e, a), fb));
+
+		scale3x_16_sse2_store(dst, scale3x_sse2_select(db, d, e), scale3x_sse2_select(m1, b, e), scale3x_sse2_select(fb, f, e));
+
+		src0 += 8;
+		src1 += 8;
+		src2 += 8;
+		dst += 24;
+		count -= 8;
+	}
+
+	if (count)
+		scale3x_16_def_border(dst, src0, src1, src2, count);
+}
+
+__attribute__((target("sse2")))
+static inline void scale3x_16_sse2_center(scale3x_uint16* __restrict__ dst, const scale3x_uint16* __restrict__ src0, const scale3x_uint16* __restrict__ src1, const scale3x_uint16* __restrict__ src2, unsigned count) {
+	while (count >= 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)(src0 - 1));
+		__m128i b = _mm_loadu_si128((const __m128i *)src0);
+		__m128i c = _mm_loadu_si128((const __m128i *)(src0 + 1));
+		__m128i d = _mm_loadu_si128((const __m128i *)(src1 - 1));
+		__m128i e = _mm_loadu_si128((const __m128i *)src1);
+		__m128i f = _mm_loadu_si128((const __m128i *)(src1 + 1));
+		__m128i g = _mm_loadu_si128((const __m128i *)(src2 - 1));
+		__m128i h = _mm_loadu_si128((const __m128i *)src2);
+		__m128i i = _mm_loadu_si128((const __m128i *)(src2 + 1));
+
+		/* B != H && D != F */
+		__m128i cond = _mm_or_si128(_mm_cmpeq_epi16(b, h), _mm_cmpeq_epi16(d, f));
+		/* (D == B && E != G) || (D == H && E != A) */
+		__m128i m0 = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi16(e, g), _mm_cmpeq_epi16(d, b)), _mm_andnot_si128(_mm_cmpeq_epi16(e, a), _mm_cmpeq_epi16(d, h)));
+		/* (F == B && E != I) || (F == H && E != C) */
+		__m128i m2 = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi16(e, i), _mm_cmpeq_epi16(f, b)), _mm_andnot_si128(_mm_cmpeq_epi16(e, c), _mm_cmpeq_epi16(f, h)));
+
+		m0 = _mm_andnot_si128(cond, m0);
+		m2 = _mm_andnot_si128(cond, m2);
+
+		scale3x_16_sse2_store(dst, scale3x_sse2_select(m0, d, e), e, scale3x_sse2_select(m2, f, e));
+
+		src0 += 8;
+		src1 += 8;
+		src2 += 8;
+		dst += 24;
+		count -= 8;
+	}
+
+	if (count)
+		scale3x_16_def_center(dst, src0, src1, src2, count);
+}
+
+/**
+ * Scale by a factor of 3 a row of pixels of 16 bits.
+ * This function operates like scale3x_16_def() but uses SSE2 instructions.
+ * It has no restriction on the row length. Before calling this function you
+ * must ensure that the current CPU supports the SSE2 instruction set.
+ * @param src0 Pointer at the first pixel of the previous row.
+ * @param src1 Pointer at the first pixel of the current row.
+ * @param src2 Pointer at the first pixel of the next row.
+ * @param count Length in pixels of the src0, src1 and src2 rows.
+ * @param dst0 First destination row, triple length in pixels.
+ * @param dst1 Second destination row, triple length in pixels.
+ * @param dst2 Third destination row, triple length in pixels.
+ */
+__attribute__((target("sse2")))
+void scale3x_16_sse2(scale3x_uint16* dst0, scale3x_uint16* dst1, scale3x_uint16* dst2, const scale3x_uint16* src0, const scale3x_uint16* src1, const scale3x_uint16* src2, unsigned count) {
+	scale3x_16_sse2_border(dst0, src0, src1, src2, count);
+	scale3x_16_sse2_center(dst1, src0, src1, src2, count);
+	scale3x_16_sse2_border(dst2, src2, src1, src0, count);
+}
+
+#endif
+
+/***************************************************************************/
+/* Scale3x NEON implementation */
+
+#if defined(SCALE3X_NEON)
+
+static inline void scale3x_16_neon_border(scale3x_uint16* __restrict__ dst, const scale3x_uint16* __restrict__ src0, const scale3x_uint16* __restrict__ src1, const scale3x_uint16* __restrict__ src2, unsigned count) {
+	while (count >= 8) {
+		uint16x8_t a = vld1q_u16(src0 - 1);
+		uint16x8_t b = vld1q_u16(src0);
+		uint16x8_t c = vld1q_u16(src0 + 1);
+		uint16x8_t d = vld1q_u16(src1 - 1);
+		uint16x8_t e = vld1q_u16(src1);
+		uint16x8_t f = vld1q_u16(src1 + 1);
+		uint16x8_t h = vld1q_u16(src2);
+
+		/* B != H && D != F */
+		uint16x8_t cond = vorrq_u16(vceqq_u16(b, h), vceqq_u16(d, f));
+		uint16x8_t db = vbicq_u16(vceqq_u16(d, b), cond);
+		uint16x8_t fb = vbicq_u16(vceqq_u16(f, b), cond);
+		/* (D == B && E != C) || (F == B && E != A) */
+		uint16x8_t m1 = vorrq_u16(vbicq_u16(db, vceqq_u16(e, c)), vbicq_u16(fb, vceqq_u16(e, a)));
+
+		uint16x8x3_t p;
+		p.val[0] = vbslq_u16(db, d, e);
+		p.val[1] = vbslq_u16(m1, b, e);
+		p.val[2] = vbslq_u16(fb, f, e);
+		vst3q_u16(dst, p);
+
+		src0 += 8;
+		src1 += 8;
+		src2 += 8;
+		dst += 24;
+		count -= 8;
+	}
+
+	if (count)
+		scale3x_16_def_border(dst, src0, src1, src2, count);
+}
+
+static inline void scale3x_16_neon_center(scale3x_uint16* __restrict__ dst, const scale3x_uint16* __restrict__ src0, const scale3x_uint16* __restrict__ src1, const scale3x_uint16* __restrict__ src2, unsigned count) {
+	while (count >= 8) {
+		uint16x8_t a = vld1q_u16(src0 - 1);
+		uint16x8_t b = vld1q_u16(src0);
+		uint16x8_t c = vld1q_u16(src0 + 1);
+		uint16x8_t d = vld1q_u16(src1 - 1);
+		uint16x8_t e = vld1q_u16(src1);
+		uint16x8_t f = vld1q_u16(src1 + 1);
+		uint16x8_t g = vld1q_u16(src2 - 1);
+		uint16x8_t h = vld1q_u16(src2);
+		uint16x8_t i = vld1q_u16(src2 + 1);
+
+		/* B != H && D != F */
+		uint16x8_t cond = vorrq_u16(vceqq_u16(b, h), vceqq_u16(d, f));
+		/* (D == B && E != G) || (D == H && E != A) */
+		uint16x8_t m0 = vorrq_u16(vbicq_u16(vceqq_u16(d, b), vceqq_u16(e, g)), vbicq_u16(vceqq_u16(d, h), vceqq_u16(e, a)));
+		/* (F == B && E != I) || (F == H && E != C) */
+		uint16x8_t m2 = vorrq_u16(vbicq_u16(vceqq_u16(f, b), vceqq_u16(e, i)), vbicq_u16(vceqq_u16(f, h), vceqq_u16(e, c)));
+
+		uint16x8x3_t p;
+		p.val[0] = vbslq_u16(vbicq_u16(m0, cond), d, e);
+		p.val[1] = e;
+		p.val[2] = vbslq_u16(vbicq_u16(m2, cond), f, e);
+		vst3q_u16(dst, p);
+
+		src0 += 8;
+		src1 += 8;
+		src2 += 8;
+		dst += 24;
+		count -= 8;
+	}
+
+	if (count)
+		scale3x_16_def_center(dst, src0, src1, src2, count);
+}
+
+/**
+ * Scale by a factor of 3 a row of pixels of 16 bits.
+ * This function operates like scale3x_16_def() but uses NEON instructions.
+ * It has no restriction on the row length.
+ * @param src0 Pointer at the first pixel of the previous row.
+ * @param src1 Pointer at the first pixel of the current row.
+ * @param src2 Pointer at the first pixel of the next row.
+ * @param count Length in pixels of the src0, src1 and src2 rows.
+ * @param dst0 First destination row, triple length in pixels.
+ * @param dst1 Second destination row, triple length in pixels.
+ * @param dst2 Third destination row, triple length in pixels.
+ */
+void scale3x_16_neon(scale3x_uint16* dst0, scale3x_uint16* dst1, scale3x_uint16* dst2, const scale3x_uint16* src0, const scale3x_uint16* src1, const scale3x_uint16* src2, unsigned count) {
+	scale3x_16_neon_border(dst0, src0, src1, src2, count);
+	scale3x_16_neon_center(dst1, src0, src1, src2, count);
+	scale3x_16_neon_border(dst2, src2, src1, src0, count);
+}
+
+#endif
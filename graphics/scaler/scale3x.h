@@ -37,4 +37,18 @@ void scale3x_8_def(scale3x_uint8* dst0, scale3x_uint8* dst1, scale3x_uint8* dst2
 void scale3x_16_def(scale3x_uint16* dst0, scale3x_uint16* dst1, scale3x_uint16* dst2, const scale3x_uint16* src0, const scale3x_uint16* src1, const scale3x_uint16* src2, unsigned count);
 void scale3x_32_def(scale3x_uint32* dst0, scale3x_uint32* dst1, scale3x_uint32* dst2, const scale3x_uint32* src0, const scale3x_uint32* src1, const scale3x_uint32* src2, unsigned count);
 
+/*
+ * The SSE2 code is always built on x86 compilers supporting the target
+ * attribute, and must be selected at runtime after checking the CPU.
+ */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && (defined(__clang__) || __GNUC__ >= 5)
+#define SCALE3X_SSE2
+void scale3x_16_sse2(scale3x_uint16* dst0, scale3x_uint16* dst1, scale3x_uint16* dst2, const scale3x_uint16* src0, const scale3x_uint16* src1, const scale3x_uint16* src2, unsigned count);
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SCALE3X_NEON
+void scale3x_16_neon(scale3x_uint16* dst0, scale3x_uint16* dst1, scale3x_uint16* dst2, const scale3x_uint16* src0, const scale3x_uint16* src1, const scale3x_uint16* src2, unsigned count);
+#endif
+
 #endif
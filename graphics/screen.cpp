@@ -27,21 +27,45 @@
 
 namespace Graphics {
 
-Screen::Screen(): ManagedSurface() {
+Screen::Screen(): ManagedSurface(), _dirtyTiles(nullptr) {
 	create(g_system->getWidth(), g_system->getHeight(), g_system->getScreenFormat());
 }
 
-Screen::Screen(int width, int height): ManagedSurface() {
+Screen::Screen(int width, int height): ManagedSurface(), _dirtyTiles(nullptr) {
 	create(width, height);
 }
 
-Screen::Screen(int width, int height, PixelFormat pixelFormat): ManagedSurface() {
+Screen::Screen(int width, int height, PixelFormat pixelFormat): ManagedSurface(), _dirtyTiles(nullptr) {
 	create(width, height, pixelFormat);
 }
 
+Screen::~Screen() {
+	delete _dirtyTiles;
+}
+
+void Screen::setDirtyTileSize(int tileSize) {
+	delete _dirtyTiles;
+	_dirtyTiles = nullptr;
+
+	if (tileSize > 0)
+		_dirtyTiles = new MicroTileArray(this->w, this->h, tileSize);
+}
+
+void Screen::clearDirtyRects() {
+	_dirtyRects.clear();
+	if (_dirtyTiles)
+		_dirtyTiles->clear();
+}
+
 void Screen::update() {
-	// Merge the dirty rects
-	mergeDirtyRects();
+	if (_dirtyTiles) {
+		// The tiles already hand back non-overlapping rects
+		_dirtyTiles->getRectangles(_dirtyRects);
+		_dirtyTiles->clear();
+	} else {
+		// Merge the dirty rects
+		mergeDirtyRects();
+	}
 
 	// Loop through copying dirty areas to the physical screen
 	Common::List<Common::Rect>::iterator i;
@@ -67,8 +91,20 @@ void Screen::addDirtyRect(const Common::Rect &r) {
 	bounds.clip(getBounds());
 	bounds.translate(getOffsetFromOwner().x, getOffsetFromOwner().y);
 
-	if (bounds.width() > 0 && bounds.height() > 0)
+	if (bounds.width() <= 0 || bounds.height() <= 0)
+		return;
+
+	if (_dirtyTiles) {
+		// Follow any change of the screen size, which invalidates everything
+		if (_dirtyTiles->getWidth() != this->w || _dirtyTiles->getHeight() != this->h) {
+			_dirtyTiles->init(this->w, this->h, _dirtyTiles->getTileSize());
+			_dirtyTiles->addRect(Common::Rect(this->w, this->h));
+		} else {
+			_dirtyTiles->addRect(bounds);
+		}
+	} else {
 		_dirtyRects.push_back(bounds);
+	}
 }
 
 void Screen::makeAllDirty() {
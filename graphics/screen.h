@@ -24,6 +24,7 @@
 #define GRAPHICS_SCREEN_H
 
 #include "graphics/managed_surface.h"
+#include "graphics/microtiles.h"
 #include "graphics/pixelformat.h"
 #include "common/list.h"
 #include "common/rect.h"
@@ -54,6 +55,12 @@ protected:
 	 * List of affected areas of the screen
 	 */
 	Common::List<Common::Rect> _dirtyRects;
+
+	/**
+	 * Micro-tile tracker for affected areas, used instead of the rect list
+	 * when enabled
+	 */
+	MicroTileArray *_dirtyTiles;
 protected:
 	/**
 	 * Merges together overlapping dirty areas of the screen
@@ -74,11 +81,21 @@ public:
 	Screen();
 	Screen(int width, int height);
 	Screen(int width, int height, PixelFormat pixelFormat);
+	~Screen() override;
 
 	/**
 	 * Returns true if there are any pending screen updates (dirty areas)
 	 */
-	bool isDirty() const { return !_dirtyRects.empty(); }
+	bool isDirty() const { return !_dirtyRects.empty() || (_dirtyTiles && !_dirtyTiles->empty()); }
+
+	/**
+	 * Tracks dirty areas in a grid of micro-tiles of the given size rather
+	 * than as a list of rectangles. This keeps the cost of adding an area
+	 * constant and hands update() a few non-overlapping rectangles, which
+	 * suits screens receiving many small overlapping updates per frame.
+	 * A size of 0 goes back to the rectangle list.
+	 */
+	void setDirtyTileSize(int tileSize);
 
 	/**
 	 * Marks the whole screen as dirty. This forces the next call to update
@@ -89,7 +106,7 @@ public:
 	/**
 	 * Clear the current dirty rects list
 	 */
-	virtual void clearDirtyRects() { _dirtyRects.clear(); }
+	virtual void clearDirtyRects();
 
 	/**
 	 * Updates the screen by copying any affected areas to the system
@@ -845,6 +845,7 @@ void SaveLoadChooserGrid::handleMouseWheel(int x, int y, int direction) {
 }
 
 void SaveLoadChooserGrid::updateSaveList() {
+	_metaInfoCache.clear();
 	SaveLoadChooserDialog::updateSaveList();
 	updateSaves();
 	g_gui.scheduleTopDialogRedraw();
@@ -853,6 +854,7 @@ void SaveLoadChooserGrid::updateSaveList() {
 void SaveLoadChooserGrid::open() {
 	SaveLoadChooserDialog::open();
 
+	_metaInfoCache.clear();
 	listSaves();
 	_resultString.clear();
 
@@ -1091,57 +1093,26 @@ void SaveLoadChooserGrid::hideButtons() {
 
 void SaveLoadChooserGrid::updateSaves() {
 	hideButtons();
+	_pendingMetaInfos.clear();
 
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
-		const uint saveSlot = _saveList[i].getSaveSlot();
-
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+		const int saveSlot = _saveList[i].getSaveSlot();
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
-		const Graphics::Surface *thumbnail = desc.getThumbnail();
-		if (thumbnail) {
-			curButton.button->setGfx(desc.getThumbnail());
-		} else {
-			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
-		}
-		curButton.description->setLabel(Common::U32String(Common::String::format("%d. ", saveSlot)) + desc.getDescription());
-
-		Common::U32String tooltip(_("Name: "));
-		tooltip += desc.getDescription();
-
-		if (_saveDateSupport) {
-			const Common::U32String &saveDate = desc.getSaveDate();
-			if (!saveDate.empty()) {
-				tooltip += Common::U32String("\n");
-				tooltip +=  _("Date: ") + saveDate;
-			}
 
-			const Common::U32String &saveTime = desc.getSaveTime();
-			if (!saveTime.empty()) {
-				tooltip += Common::U32String("\n");
-				tooltip += _("Time: ") + saveTime;
-			}
+		if (_saveList[i].getLocked()) {
+			updateSlotButton(curButton, _saveList[i], false);
+			continue;
 		}
 
-		if (_playTimeSupport) {
-			const Common::U32String &playTime = desc.getPlayTime();
-			if (!playTime.empty()) {
-				tooltip += Common::U32String("\n");
-				tooltip += _("Playtime: ") + playTime;
-			}
-		}
-
-		curButton.button->setTooltip(tooltip);
-
-		// In save mode we disable the button, when it's write protected.
-		// TODO: Maybe we should not display it at all then?
-		// We also disable and description the button if slot is locked
-		if ((_saveMode && desc.getWriteProtectedFlag()) || desc.getLocked()) {
-			curButton.button->setEnabled(false);
+		MetaInfoCache::const_iterator cached = _metaInfoCache.find(saveSlot);
+		if (cached != _metaInfoCache.end()) {
+			updateSlotButton(curButton, cached->_value, false);
 		} else {
-			curButton.button->setEnabled(true);
+			// Show what listSaves told us until the meta infos are loaded
+			updateSlotButton(curButton, _saveList[i], true);
+			_pendingMetaInfos.push_back(i);
 		}
-		curButton.description->setEnabled(!desc.getLocked());
 	}
 
 	const uint numPages = (_entriesPerPage != 0 && !_saveList.empty()) ? ((_saveList.size() + _entriesPerPage - 1) / _entriesPerPage) : 1;
@@ -1158,6 +1129,85 @@ void SaveLoadChooserGrid::updateSaves() {
 		_nextButton->setEnabled(false);
 }
 
+void SaveLoadChooserGrid::updateSlotButton(SlotButton &curButton, const SaveStateDescriptor &desc, bool placeholder) {
+	const Graphics::Surface *thumbnail = desc.getThumbnail();
+	if (thumbnail) {
+		curButton.button->setGfx(thumbnail);
+	} else {
+		curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+	}
+	curButton.description->setLabel(Common::U32String(Common::String::format("%d. ", desc.getSaveSlot())) + desc.getDescription());
+
+	Common::U32String tooltip(_("Name: "));
+	tooltip += desc.getDescription();
+
+	if (_saveDateSupport) {
+		const Common::U32String &saveDate = desc.getSaveDate();
+		if (!saveDate.empty()) {
+			tooltip += Common::U32String("\n");
+			tooltip +=  _("Date: ") + saveDate;
+		}
+
+		const Common::U32String &saveTime = desc.getSaveTime();
+		if (!saveTime.empty()) {
+			tooltip += Common::U32String("\n");
+			tooltip += _("Time: ") + saveTime;
+		}
+	}
+
+	if (_playTimeSupport) {
+		const Common::U32String &playTime = desc.getPlayTime();
+		if (!playTime.empty()) {
+			tooltip += Common::U32String("\n");
+			tooltip += _("Playtime: ") + playTime;
+		}
+	}
+
+	curButton.button->setTooltip(tooltip);
+
+	// In save mode we disable the button, when it's write protected.
+	// TODO: Maybe we should not display it at all then?
+	// We also disable and description the button if slot is locked.
+	// While the meta infos are not loaded yet we do not know whether the
+	// slot is write protected, so we keep it disabled in save mode.
+	if ((_saveMode && (placeholder || desc.getWriteProtectedFlag())) || desc.getLocked()) {
+		curButton.button->setEnabled(false);
+	} else {
+		curButton.button->setEnabled(true);
+	}
+	curButton.description->setEnabled(!desc.getLocked());
+}
+
+void SaveLoadChooserGrid::loadPendingMetaInfos() {
+	// Spend a bounded amount of time per tick, so the dialog stays
+	// responsive while thumbnails are loaded from slow storage.
+	const uint32 startTime = g_system->getMillis();
+
+	while (!_pendingMetaInfos.empty() && g_system->getMillis() - startTime < 20) {
+		const uint i = _pendingMetaInfos.remove_at(0);
+		const int saveSlot = _saveList[i].getSaveSlot();
+
+		SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
+		// Some engines do not fill in the slot when querying meta infos
+		desc.setSaveSlot(saveSlot);
+		_metaInfoCache[saveSlot] = desc;
+
+		const uint curNum = i - _curPage * _entriesPerPage;
+		SlotButton &curButton = _buttons[curNum];
+		updateSlotButton(curButton, desc, false);
+		curButton.container->markAsDirty();
+	}
+}
+
+void SaveLoadChooserGrid::handleTickle() {
+	if (!_pendingMetaInfos.empty()) {
+		loadPendingMetaInfos();
+		g_gui.scheduleTopDialogRedraw();
+	}
+
+	SaveLoadChooserDialog::handleTickle();
+}
+
 SavenameDialog::SavenameDialog()
 	: Dialog("SavenameDialog") {
 	_title = new StaticTextWidget(this, "SavenameDialog.DescriptionText", Common::String());
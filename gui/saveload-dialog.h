@@ -208,6 +208,8 @@ public:
 	SaveLoadChooserType getType() const override { return kSaveLoadDialogGrid; }
 
 	void close() override;
+
+	void handleTickle() override;
 protected:
 	void handleCommand(CommandSender *sender, uint32 cmd, uint32 data) override;
 	void handleMouseWheel(int x, int y, int direction) override;
@@ -249,6 +251,23 @@ private:
 	void destroyButtons();
 	void hideButtons();
 	void updateSaves();
+	void updateSlotButton(SlotButton &button, const SaveStateDescriptor &desc, bool placeholder);
+
+	/**
+	 * Meta infos (including thumbnails) of the saves loaded so far, indexed
+	 * by save slot. Only saves shown on a page are ever queried; the cache
+	 * is reset whenever the save list is refreshed.
+	 */
+	typedef Common::HashMap<int, SaveStateDescriptor> MetaInfoCache;
+	MetaInfoCache _metaInfoCache;
+
+	/**
+	 * Indices into _saveList of the saves on the current page for which the
+	 * meta infos still have to be queried. These are loaded in handleTickle
+	 * while placeholders are displayed, so the dialog appears immediately.
+	 */
+	Common::Array<uint> _pendingMetaInfos;
+	void loadPendingMetaInfos();
 };
 
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -48,13 +48,19 @@ namespace Image {
 JPEGDecoder::JPEGDecoder() :
 		_surface(),
 		_colorSpace(kColorSpaceRGB),
-		_requestedPixelFormat(getByteOrderRgbPixelFormat()) {
+		_requestedPixelFormat(getByteOrderRgbPixelFormat()),
+		_scaleDenominator(1) {
 }
 
 JPEGDecoder::~JPEGDecoder() {
 	destroy();
 }
 
+void JPEGDecoder::setOutputScale(uint denominator) {
+	assert(denominator == 1 || denominator == 2 || denominator == 4 || denominator == 8);
+	_scaleDenominator = denominator;
+}
+
 Graphics::PixelFormat JPEGDecoder::getByteOrderRgbPixelFormat() const {
 #ifdef SCUMM_BIG_ENDIAN
 	return Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0);
@@ -272,9 +278,17 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		break;
 	}
 
+	// Let the inverse DCT do the downscaling
+	cinfo.scale_num = 1;
+	cinfo.scale_denom = _scaleDenominator;
+
 	// Actually start decompressing the image
 	jpeg_start_decompress(&cinfo);
 
+	Common::Rect rect(cinfo.output_width, cinfo.output_height);
+	if (!_outputRect.isEmpty())
+		rect.clip(_outputRect);
+
 	// Allocate buffers for the output data
 	switch (_colorSpace) {
 	case kColorSpaceRGB: {
@@ -284,34 +298,55 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		} else {
 			outputPixelFormat = _requestedPixelFormat;
 		}
-		_surface.create(cinfo.output_width, cinfo.output_height, outputPixelFormat);
+		_surface.create(rect.width(), rect.height(), outputPixelFormat);
 		break;
 	}
 	case kColorSpaceYUV:
 		// We use YUV with 3 bytes per pixel otherwise.
 		// This is pretty ugly since our PixelFormat cannot express YUV...
-		_surface.create(cinfo.output_width, cinfo.output_height, Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0));
+		_surface.create(rect.width(), rect.height(), Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0));
 		break;
 	default:
 		break;
 	}
 
-	// Allocate buffer for one scanline
-	JDIMENSION pitch = cinfo.output_width * _surface.format.bytesPerPixel;
-	assert(_surface.pitch >= pitch);
-	JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
+	// Skip the rows above the requested rectangle
+	if (rect.top > 0) {
+#ifdef LIBJPEG_TURBO_VERSION_NUMBER
+		jpeg_skip_scanlines(&cinfo, rect.top);
+#endif
+	}
 
-	// Go through the image data scanline by scanline
-	while (cinfo.output_scanline < cinfo.output_height) {
-		byte *dst = (byte *)_surface.getBasePtr(0, cinfo.output_scanline);
+	bool fullWidth = rect.width() == (int16)cinfo.output_width;
+	JSAMPARRAY buffer = nullptr;
+	if (rect.top > (int16)cinfo.output_scanline || !fullWidth) {
+		// Allocate buffer for one scanline
+		JDIMENSION pitch = cinfo.output_width * _surface.format.bytesPerPixel;
+		buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
+	}
 
+	while (cinfo.output_scanline < (JDIMENSION)rect.top)
 		jpeg_read_scanlines(&cinfo, buffer, 1);
 
-		memcpy(dst, buffer[0], pitch);
+	// Go through the requested image data scanline by scanline
+	while (cinfo.output_scanline < (JDIMENSION)rect.bottom) {
+		byte *dst = (byte *)_surface.getBasePtr(0, cinfo.output_scanline - rect.top);
+
+		if (fullWidth) {
+			// Decode straight into the surface
+			JSAMPROW row = dst;
+			jpeg_read_scanlines(&cinfo, &row, 1);
+		} else {
+			jpeg_read_scanlines(&cinfo, buffer, 1);
+			memcpy(dst, buffer[0] + rect.left * _surface.format.bytesPerPixel, _surface.pitch);
+		}
 	}
 
 	// We are done with decompressing, thus free all the data
-	jpeg_finish_decompress(&cinfo);
+	if (cinfo.output_scanline < cinfo.output_height)
+		jpeg_abort_decompress(&cinfo);
+	else
+		jpeg_finish_decompress(&cinfo);
 	jpeg_destroy_decompress(&cinfo);
 
 	if (_colorSpace == kColorSpaceRGB && _surface.format != _requestedPixelFormat) {
@@ -23,6 +23,7 @@
 #ifndef IMAGE_JPEG_H
 #define IMAGE_JPEG_H
 
+#include "common/rect.h"
 #include "graphics/surface.h"
 #include "image/image_decoder.h"
 #include "image/codecs/codec.h"
@@ -102,10 +103,37 @@ public:
 	 */
 	void setOutputPixelFormat(const Graphics::PixelFormat &format) { _requestedPixelFormat = format; }
 
+	/**
+	 * Request a downscaled output. The scaling is performed as part of the
+	 * inverse DCT, which makes it much cheaper than decoding the full image
+	 * and scaling it afterwards. This is useful for thumbnails.
+	 *
+	 * The decoder itself defaults to no scaling.
+	 *
+	 * @param denominator The output size is 1/denominator of the image size.
+	 *                    Must be 1, 2, 4 or 8.
+	 */
+	void setOutputScale(uint denominator);
+
+	/**
+	 * Request only a part of the image to be output. Rows below the
+	 * rectangle are not decoded at all.
+	 *
+	 * The rectangle is expressed in output coordinates, that is after the
+	 * scaling requested using `setOutputScale` has been applied. It is
+	 * clipped to the image bounds. An empty rectangle, the default, outputs
+	 * the whole image.
+	 *
+	 * @param rect The part of the image to output.
+	 */
+	void setOutputRect(const Common::Rect &rect) { _outputRect = rect; }
+
 private:
 	Graphics::Surface _surface;
 	ColorSpace _colorSpace;
 	Graphics::PixelFormat _requestedPixelFormat;
+	uint _scaleDenominator;
+	Common::Rect _outputRect;
 
 	Graphics::PixelFormat getByteOrderRgbPixelFormat() const;
 };
@@ -72,8 +72,8 @@ void AABB::transform(const Math::Matrix4 &matrix) {
 	verts[6].set(min.x(), max.y(), max.z());
 	verts[7].set(max.x(), max.y(), max.z());
 
+	matrix.transform(verts, verts, 8, true);
 	for (int i = 0; i < 8; ++i) {
-		matrix.transform(&verts[i], true);
 		expand(verts[i]);
 	}
 }
@@ -37,6 +37,12 @@
 #include "math/vector4d.h"
 #include "math/squarematrix.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace Math {
 
 Matrix<4, 4>::Matrix() :
@@ -50,15 +56,113 @@ Matrix<4, 4>::Matrix(const MatrixBase<4, 4> &m) :
 }
 
 void Matrix<4, 4>::transform(Vector3d *v, bool trans) const {
-	Vector4d m;
-	m(0, 0) = v->x();
-	m(1, 0) = v->y();
-	m(2, 0) = v->z();
-	m(3, 0) = (trans ? 1.f : 0.f);
+	const float *m = getData();
+	const float x = v->x();
+	const float y = v->y();
+	const float z = v->z();
+	const float w = (trans ? 1.f : 0.f);
+
+	v->set(m[0] * x + m[1] * y + m[2] * z + m[3] * w,
+	       m[4] * x + m[5] * y + m[6] * z + m[7] * w,
+	       m[8] * x + m[9] * y + m[10] * z + m[11] * w);
+}
+
+void Matrix<4, 4>::transform(const Vector3d *in, Vector3d *out, int n, bool trans) const {
+	const float *m = getData();
+
+#if defined(__SSE2__)
+	// Keep the columns of the matrix in registers, so that every vector only
+	// needs three broadcasts and three multiply-adds.
+	const __m128 col0 = _mm_setr_ps(m[0], m[4], m[8], m[12]);
+	const __m128 col1 = _mm_setr_ps(m[1], m[5], m[9], m[13]);
+	const __m128 col2 = _mm_setr_ps(m[2], m[6], m[10], m[14]);
+	const __m128 col3 = trans ? _mm_setr_ps(m[3], m[7], m[11], m[15]) : _mm_setzero_ps();
+
+	for (int i = 0; i < n; i++) {
+		const float *v = in[i].getData();
+		__m128 r = _mm_mul_ps(col0, _mm_set1_ps(v[0]));
+		r = _mm_add_ps(r, _mm_mul_ps(col1, _mm_set1_ps(v[1])));
+		r = _mm_add_ps(r, _mm_mul_ps(col2, _mm_set1_ps(v[2])));
+		r = _mm_add_ps(r, col3);
+
+		float *o = out[i].getData();
+		_mm_storel_pi((__m64 *)o, r);
+		_mm_store_ss(o + 2, _mm_movehl_ps(r, r));
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	const float c0[4] = { m[0], m[4], m[8], m[12] };
+	const float c1[4] = { m[1], m[5], m[9], m[13] };
+	const float c2[4] = { m[2], m[6], m[10], m[14] };
+	const float c3[4] = { m[3], m[7], m[11], m[15] };
+	const float32x4_t col0 = vld1q_f32(c0);
+	const float32x4_t col1 = vld1q_f32(c1);
+	const float32x4_t col2 = vld1q_f32(c2);
+	const float32x4_t col3 = trans ? vld1q_f32(c3) : vdupq_n_f32(0.f);
+
+	for (int i = 0; i < n; i++) {
+		const float *v = in[i].getData();
+		float32x4_t r = vmulq_n_f32(col0, v[0]);
+		r = vmlaq_n_f32(r, col1, v[1]);
+		r = vmlaq_n_f32(r, col2, v[2]);
+		r = vaddq_f32(r, col3);
+
+		float *o = out[i].getData();
+		vst1_f32(o, vget_low_f32(r));
+		vst1q_lane_f32(o + 2, r, 2);
+	}
+#else
+	for (int i = 0; i < n; i++) {
+		out[i] = in[i];
+		transform(&out[i], trans);
+	}
+#endif
+}
+
+Matrix<4, 4> Matrix<4, 4>::operator*(const Matrix<4, 4> &m2) const {
+	Matrix<4, 4> result;
+	const float *d1 = getData();
+	const float *d2 = m2.getData();
+	float *r = result.getData();
+
+#if defined(__SSE2__)
+	// Every row of the result is a linear combination of the rows of m2
+	const __m128 row0 = _mm_loadu_ps(d2 + 0);
+	const __m128 row1 = _mm_loadu_ps(d2 + 4);
+	const __m128 row2 = _mm_loadu_ps(d2 + 8);
+	const __m128 row3 = _mm_loadu_ps(d2 + 12);
+
+	for (int i = 0; i < 16; i += 4) {
+		__m128 sum = _mm_mul_ps(_mm_set1_ps(d1[i + 0]), row0);
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(d1[i + 1]), row1));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(d1[i + 2]), row2));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(d1[i + 3]), row3));
+		_mm_storeu_ps(r + i, sum);
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	const float32x4_t row0 = vld1q_f32(d2 + 0);
+	const float32x4_t row1 = vld1q_f32(d2 + 4);
+	const float32x4_t row2 = vld1q_f32(d2 + 8);
+	const float32x4_t row3 = vld1q_f32(d2 + 12);
 
-	m = *this * m;
+	for (int i = 0; i < 16; i += 4) {
+		float32x4_t sum = vmulq_n_f32(row0, d1[i + 0]);
+		sum = vmlaq_n_f32(sum, row1, d1[i + 1]);
+		sum = vmlaq_n_f32(sum, row2, d1[i + 2]);
+		sum = vmlaq_n_f32(sum, row3, d1[i + 3]);
+		vst1q_f32(r + i, sum);
+	}
+#else
+	for (int i = 0; i < 16; i += 4) {
+		for (int j = 0; j < 4; ++j) {
+			r[i + j] = (d1[i + 0] * d2[j + 0])
+				+ (d1[i + 1] * d2[j + 4])
+				+ (d1[i + 2] * d2[j + 8])
+				+ (d1[i + 3] * d2[j + 12]);
+		}
+	}
+#endif
 
-	v->set(m(0, 0), m(1, 0), m(2, 0));
+	return result;
 }
 
 Vector3d Matrix<4, 4>::getPosition() const {
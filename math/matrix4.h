@@ -40,6 +40,19 @@ public:
 	Matrix(const Angle &first, const Angle &second, const Angle &third, EulerOrder order) { buildFromEuler(first, second, third, order); }
 
 	void transform(Vector3d *v, bool translate) const;
+	/**
+	 * Transforms an array of vectors.
+	 *
+	 * This produces the same results as calling transform() on each vector,
+	 * but uses SIMD instructions where available. The input and output arrays
+	 * may be the same, but must not partially overlap.
+	 *
+	 * @param in        The vectors to transform.
+	 * @param out       The array receiving the transformed vectors.
+	 * @param n         The number of vectors.
+	 * @param translate Whether to apply the translation part of the matrix.
+	 */
+	void transform(const Vector3d *in, Vector3d *out, int n, bool translate) const;
 	void inverseTranslate(Vector3d *v) const;
 	void inverseRotate(Vector3d *v) const;
 	
@@ -77,23 +90,7 @@ public:
 
 	void transpose();
 
-	inline Matrix<4, 4> operator*(const Matrix<4, 4> &m2) const {
-		Matrix<4, 4> result;
-		const float *d1 = getData();
-		const float *d2 = m2.getData();
-		float *r = result.getData();
-
-		for (int i = 0; i < 16; i += 4) {
-			for (int j = 0; j < 4; ++j) {
-				r[i + j] = (d1[i + 0] * d2[j + 0])
-					+ (d1[i + 1] * d2[j + 4])
-					+ (d1[i + 2] * d2[j + 8])
-					+ (d1[i + 3] * d2[j + 12]);
-			}
-		}
-
-		return result;
-	}
+	Matrix<4, 4> operator*(const Matrix<4, 4> &m2) const;
 
 	inline Vector4d transform(const Vector4d &v) const {
 		Vector4d result;
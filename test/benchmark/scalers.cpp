@@ -0,0 +1,137 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * Benchmark of the scalers. Every implementation the CPU supports scales a
+ * 320x200 16bpp frame repeatedly, and its output is compared to the one of
+ * the last, portable, implementation of the same scaler.
+ *
+ * Use the 'benchmark' target to build and run it. The number of frames can
+ * be given as argument.
+ */
+
+#define FORBIDDEN_SYMBOL_EXCEPTION_printf
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
+#include "common/scummsys.h"
+#include "graphics/scaler.h"
+
+#include <time.h>
+
+enum {
+	kWidth = 320,
+	kHeight = 200,
+	kFrames = 200
+};
+
+/**
+ * Fill the source with flat areas, gradients and noise, so the edge
+ * detecting scalers go through many of their cases.
+ */
+static void fillSource(uint16 *src, int width, int height) {
+	static const uint16 colors[] = { 0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0x8410 };
+	uint32 seed = 12345;
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			seed = seed * 1103515245 + 12345;
+			const uint32 r = seed >> 16;
+
+			uint16 color;
+			if (x < width / 3)
+				color = colors[(x / 8 + y / 6 + (x > y ? 1 : 0)) % 6];
+			else if (x < 2 * width / 3)
+				color = (uint16)(((x & 0x1F) << 11) | ((y & 0x3F) << 5) | ((x + y) & 0x1F));
+			else
+				color = (r & 3) ? colors[r % 6] : (uint16)r;
+
+			*src++ = color;
+		}
+	}
+}
+
+static const char *getFeatureName(uint32 features) {
+	if (features & kScalerCPUFeatureAVX2)
+		return "AVX2";
+	if (features & kScalerCPUFeatureSSE2)
+		return "SSE2";
+	if (features & kScalerCPUFeatureMMX)
+		return "MMX";
+	if (features & kScalerCPUFeatureNEON)
+		return "NEON";
+	return "base";
+}
+
+int main(int argc, char *argv[]) {
+	const int frames = (argc > 1 && atoi(argv[1]) > 0) ? atoi(argv[1]) : kFrames;
+
+	InitScalers(565);
+
+	// The scalers read one pixel around the scaled area
+	const int srcWidth = kWidth + 2;
+	const uint32 srcPitch = srcWidth * sizeof(uint16);
+	uint16 *srcBuffer = (uint16 *)malloc(srcPitch * (kHeight + 2));
+	fillSource(srcBuffer, srcWidth, kHeight + 2);
+	const uint8 *src = (const uint8 *)(srcBuffer + srcWidth + 1);
+
+	int mismatches = 0;
+
+	for (const ScalerDescriptor *desc = getScalerDescriptors(); desc->name; ++desc) {
+		const uint32 dstPitch = kWidth * desc->factor * sizeof(uint16);
+		const uint32 dstSize = dstPitch * kHeight * desc->factor;
+		uint8 *reference = (uint8 *)malloc(dstSize);
+		uint8 *dst = (uint8 *)malloc(dstSize);
+
+		const ScalerImplementation *portable = desc->implementations;
+		while (portable[1].proc)
+			++portable;
+		portable->proc(src, srcPitch, reference, dstPitch, kWidth, kHeight);
+
+		for (const ScalerImplementation *impl = desc->implementations; impl->proc; ++impl) {
+			if ((impl->cpuFeatures & getScalerCPUFeatures()) != impl->cpuFeatures) {
+				printf("%-12s %-5s  not supported by this CPU\n", desc->name, getFeatureName(impl->cpuFeatures));
+				continue;
+			}
+
+			memset(dst, 0, dstSize);
+			const clock_t start = clock();
+			for (int i = 0; i < frames; ++i)
+				impl->proc(src, srcPitch, dst, dstPitch, kWidth, kHeight);
+			const double msecs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+			const bool matches = memcmp(dst, reference, dstSize) == 0;
+			if (!matches)
+				++mismatches;
+
+			printf("%-12s %-5s %8.3f ms/frame%s\n", desc->name, getFeatureName(impl->cpuFeatures),
+				msecs / frames, matches ? "" : "  output differs from the portable version");
+		}
+
+		free(dst);
+		free(reference);
+	}
+
+	free(srcBuffer);
+	DestroyScalers();
+
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,92 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/zlib.h"
+
+// The chunked format needs zlib for both writing and reading
+class ZlibTestSuite : public CxxTest::TestSuite {
+#ifdef USE_ZLIB
+	Common::SeekableReadStream *writeChunked(const byte *data, uint32 size, uint32 chunkSize) {
+		Common::MemoryWriteStreamDynamic *mem = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+		Common::WriteStream *stream = Common::wrapChunkedCompressedWriteStream(mem, chunkSize);
+
+		stream->write(data, size);
+		stream->finalize();
+		TS_ASSERT(!stream->err());
+
+		byte *compressed = mem->getData();
+		uint32 compressedSize = mem->size();
+		delete stream;
+
+		return Common::wrapCompressedReadStream(new Common::MemoryReadStream(compressed, compressedSize, DisposeAfterUse::YES));
+	}
+#endif
+
+	public:
+	void test_chunked_roundtrip() {
+#ifdef USE_ZLIB
+		byte data[1000];
+		for (uint i = 0; i < sizeof(data); ++i)
+			data[i] = (i * 7) ^ (i >> 3);
+
+		Common::SeekableReadStream *stream = writeChunked(data, sizeof(data), 64);
+		TS_ASSERT(stream);
+		TS_ASSERT_EQUALS(stream->size(), (int32)sizeof(data));
+
+		byte read[1000];
+		TS_ASSERT_EQUALS(stream->read(read, sizeof(read)), sizeof(read));
+		TS_ASSERT(memcmp(data, read, sizeof(data)) == 0);
+		TS_ASSERT(!stream->eos());
+		stream->readByte();
+		TS_ASSERT(stream->eos());
+
+		delete stream;
+#endif
+	}
+
+	void test_chunked_seek() {
+#ifdef USE_ZLIB
+		byte data[300];
+		for (uint i = 0; i < sizeof(data); ++i)
+			data[i] = i & 0xFF;
+
+		Common::SeekableReadStream *stream = writeChunked(data, sizeof(data), 32);
+		TS_ASSERT(stream);
+
+		// Seeking backwards and across chunk boundaries
+		TS_ASSERT(stream->seek(250));
+		TS_ASSERT_EQUALS(stream->readByte(), data[250]);
+		TS_ASSERT(stream->seek(5));
+		TS_ASSERT_EQUALS(stream->readByte(), data[5]);
+		TS_ASSERT(stream->seek(-1, SEEK_END));
+		TS_ASSERT_EQUALS(stream->readByte(), data[299]);
+		TS_ASSERT(stream->seek(30));
+		byte read[10];
+		TS_ASSERT_EQUALS(stream->read(read, sizeof(read)), sizeof(read));
+		TS_ASSERT(memcmp(data + 30, read, sizeof(read)) == 0);
+		TS_ASSERT_EQUALS(stream->pos(), 40);
+
+		delete stream;
+#endif
+	}
+
+	void test_chunked_empty() {
+#ifdef USE_ZLIB
+		Common::SeekableReadStream *stream = writeChunked(nullptr, 0, 32);
+		TS_ASSERT(stream);
+		TS_ASSERT_EQUALS(stream->size(), 0);
+		stream->readByte();
+		TS_ASSERT(stream->eos());
+		delete stream;
+#endif
+	}
+
+	void test_uncompressed_passthrough() {
+		const byte data[4] = { 'A', 'B', 'C', 'D' };
+		Common::SeekableReadStream *mem = new Common::MemoryReadStream(data, sizeof(data));
+		Common::SeekableReadStream *stream = Common::wrapCompressedReadStream(mem);
+		TS_ASSERT_EQUALS(stream, mem);
+		TS_ASSERT_EQUALS(stream->pos(), 0);
+		delete stream;
+	}
+};
@@ -0,0 +1,105 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/microtiles.h"
+
+class MicroTileArrayTestSuite : public CxxTest::TestSuite
+{
+	static int coverage(const Common::List<Common::Rect> &rects, int16 x, int16 y) {
+		int count = 0;
+		for (Common::List<Common::Rect>::const_iterator i = rects.begin(); i != rects.end(); ++i)
+			if (i->contains(x, y))
+				++count;
+		return count;
+	}
+
+	public:
+	void test_empty() {
+		Graphics::MicroTileArray tiles(100, 60, 16);
+		TS_ASSERT(tiles.empty());
+
+		Common::List<Common::Rect> rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT(rects.empty());
+
+		tiles.addRect(Common::Rect(100, 60, 120, 80));
+		tiles.addRect(Common::Rect(10, 10, 10, 20));
+		tiles.getRectangles(rects);
+		TS_ASSERT(rects.empty());
+	}
+
+	void test_single_pixel() {
+		Graphics::MicroTileArray tiles(64, 64, 16);
+		tiles.addRect(Common::Rect(0, 0, 1, 1));
+		TS_ASSERT(!tiles.empty());
+
+		Common::List<Common::Rect> rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects.front(), Common::Rect(0, 0, 1, 1));
+
+		tiles.clear();
+		TS_ASSERT(tiles.empty());
+	}
+
+	void test_merge_across_tiles() {
+		// A rectangle spanning several tiles, including the partial last
+		// column, comes back as one rectangle
+		Graphics::MicroTileArray tiles(100, 70, 16);
+		const Common::Rect r(5, 3, 100, 64);
+		tiles.addRect(r);
+
+		Common::List<Common::Rect> rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects.front(), r);
+	}
+
+	void test_overlapping_rects() {
+		// Overlapping updates never produce overlapping output
+		Graphics::MicroTileArray tiles(64, 48, 16);
+		tiles.addRect(Common::Rect(0, 0, 40, 20));
+		tiles.addRect(Common::Rect(16, 16, 64, 48));
+
+		Common::List<Common::Rect> rects;
+		tiles.getRectangles(rects);
+
+		// The dirty tile boxes are:
+		// row 0: two full tiles and 8 columns of the third (40x16)
+		// row 1: 4 lines of the first tile, then three full tiles (16x4 + 48x16)
+		// row 2: the last three tiles (48x16)
+		int area = 0;
+		for (int16 y = 0; y < 48; ++y) {
+			for (int16 x = 0; x < 64; ++x) {
+				const int count = coverage(rects, x, y);
+				TS_ASSERT(count <= 1);
+				area += count;
+			}
+		}
+		TS_ASSERT_EQUALS(area, 40 * 16 + 16 * 4 + 48 * 16 + 48 * 16);
+		TS_ASSERT_EQUALS(coverage(rects, 0, 19), 1);
+		TS_ASSERT_EQUALS(coverage(rects, 0, 20), 0);
+		TS_ASSERT_EQUALS(coverage(rects, 40, 0), 0);
+	}
+
+	void test_clipping() {
+		Graphics::MicroTileArray tiles(40, 30, 8);
+		tiles.addRect(Common::Rect(-10, -10, 50, 50));
+
+		Common::List<Common::Rect> rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects.front(), Common::Rect(40, 30));
+	}
+
+	void test_bounding_box_per_tile() {
+		// Two small updates in one tile are combined into their bounding box
+		Graphics::MicroTileArray tiles(32, 32, 32);
+		tiles.addRect(Common::Rect(2, 2, 4, 4));
+		tiles.addRect(Common::Rect(10, 6, 12, 9));
+
+		Common::List<Common::Rect> rects;
+		tiles.getRectangles(rects);
+		TS_ASSERT_EQUALS(rects.size(), 1u);
+		TS_ASSERT_EQUALS(rects.front(), Common::Rect(2, 2, 12, 9));
+	}
+};
@@ -0,0 +1,85 @@
+#include <cxxtest/TestSuite.h>
+
+#include "math/matrix4.h"
+#include "math/quat.h"
+
+class Matrix4TestSuite : public CxxTest::TestSuite {
+	Math::Matrix4 makeMatrix(float x, float y, float z) {
+		Math::Matrix4 m = Math::Quaternion::fromEuler(Math::Angle(x), Math::Angle(y), Math::Angle(z), Math::EO_XYZ).toMatrix();
+		m.setPosition(Math::Vector3d(x, -y, z * 0.5f));
+		return m;
+	}
+
+public:
+	// Test the matrix product against the generic implementation
+	void test_multiply() {
+		Math::Matrix4 a = makeMatrix(20, 30, 40);
+		Math::Matrix4 b = makeMatrix(-70, 15, 5);
+		a.setValue(3, 0, 0.25f);
+		b.setValue(3, 2, -2.0f);
+
+		Math::Matrix4 r = a * b;
+
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				float expected = 0.0f;
+				for (int k = 0; k < 4; ++k)
+					expected += a.getValue(i, k) * b.getValue(k, j);
+				TS_ASSERT(fabs(r.getValue(i, j) - expected) < 0.0001f);
+			}
+		}
+	}
+
+	// Test transforming a single vector
+	void test_transform() {
+		Math::Matrix4 m = makeMatrix(10, 20, 30);
+
+		Math::Vector3d v(1.0f, 2.0f, 3.0f);
+		m.transform(&v, true);
+
+		Math::Vector4d expected = m * Math::Vector4d(1.0f, 2.0f, 3.0f, 1.0f);
+		TS_ASSERT(fabs(v.x() - expected.x()) < 0.0001f);
+		TS_ASSERT(fabs(v.y() - expected.y()) < 0.0001f);
+		TS_ASSERT(fabs(v.z() - expected.z()) < 0.0001f);
+
+		Math::Vector3d n(1.0f, 2.0f, 3.0f);
+		m.transform(&n, false);
+
+		expected = m * Math::Vector4d(1.0f, 2.0f, 3.0f, 0.0f);
+		TS_ASSERT(fabs(n.x() - expected.x()) < 0.0001f);
+		TS_ASSERT(fabs(n.y() - expected.y()) < 0.0001f);
+		TS_ASSERT(fabs(n.z() - expected.z()) < 0.0001f);
+	}
+
+	// Test that transforming an array gives the same results as transforming each vector
+	void test_transformArray() {
+		Math::Matrix4 m = makeMatrix(-45, 60, 90);
+
+		const int count = 37;
+		Math::Vector3d in[count];
+		Math::Vector3d out[count];
+		for (int i = 0; i < count; ++i)
+			in[i].set(i * 0.5f, -i * 1.25f, 3.0f - i);
+
+		for (int pass = 0; pass < 2; ++pass) {
+			bool translate = (pass == 0);
+			m.transform(in, out, count, translate);
+
+			for (int i = 0; i < count; ++i) {
+				Math::Vector3d expected = in[i];
+				m.transform(&expected, translate);
+				TS_ASSERT(fabs(out[i].x() - expected.x()) < 0.0001f);
+				TS_ASSERT(fabs(out[i].y() - expected.y()) < 0.0001f);
+				TS_ASSERT(fabs(out[i].z() - expected.z()) < 0.0001f);
+			}
+		}
+
+		// Transforming in place
+		Math::Vector3d expected = in[5];
+		m.transform(&expected, true);
+		m.transform(in, in, count, true);
+		TS_ASSERT(fabs(in[5].x() - expected.x()) < 0.0001f);
+		TS_ASSERT(fabs(in[5].y() - expected.y()) < 0.0001f);
+		TS_ASSERT(fabs(in[5].z() - expected.z()) < 0.0001f);
+	}
+};
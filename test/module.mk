@@ -5,7 +5,7 @@
 #
 ######################################################################
 
-TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/math/*.h
+TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/math/*.h $(srcdir)/test/graphics/*.h
 TEST_LIBS    :=
 
 ifdef POSIX
@@ -30,7 +30,7 @@ TEST_LIBS += test/null_osystem.o \
 	test/stubs.o
 endif
 
-TEST_LIBS +=	audio/libaudio.a math/libmath.a common/libcommon.a
+TEST_LIBS +=	audio/libaudio.a graphics/libgraphics.a math/libmath.a common/libcommon.a
 
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
@@ -76,13 +76,20 @@ test/runner.cpp: $(TESTS)
 	@mkdir -p test
 	$(srcdir)/test/cxxtest/cxxtestgen.py $(TEST_FLAGS) -o $@ $+
 
+# Scaler benchmark, run it with the 'benchmark' target.
+benchmark: test/benchmark/scalers
+	./test/benchmark/scalers
+test/benchmark/scalers: $(srcdir)/test/benchmark/scalers.cpp $(TEST_LIBS)
+	$(QUIET)$(MKDIR) test/benchmark
+	$(QUIET_CXX)$(CXX) $(TEST_CXXFLAGS) $(CPPFLAGS) $(CFLAGS) -o $@ $< $(TEST_LIBS) $(TEST_LDFLAGS)
+
 clean: clean-test
 clean-test:
-	-$(RM) test/runner.cpp test/runner test/engine-data/encoding.dat
+	-$(RM) test/runner.cpp test/runner test/engine-data/encoding.dat test/benchmark/scalers
 	-rmdir test/engine-data
 
 copy-dat:
 	$(MKDIR) test/engine-data
 	$(CP) $(srcdir)/dists/engine-data/encoding.dat test/engine-data/encoding.dat
 
-.PHONY: test clean-test copy-dat
+.PHONY: test benchmark clean-test copy-dat